@@ -0,0 +1,32 @@
+#pragma once
+
+#include <chrono>
+
+// Each suite logs its timings and returns false when a check fails
+namespace ClaudeEngine::Benchmarks {
+
+    bool RunSpatial();
+    bool RunUniforms();
+    bool RunMaterials();
+    bool RunGPUCulling();
+    bool RunVertexFormats();
+    bool RunMeshlets();
+    bool RunPicking();
+
+    // GPU suites: clear stale errors before a measured section, then check it left none behind
+    void DrainGLErrors();
+    bool CheckGLErrors(const char* section);
+
+    class Timer {
+    public:
+        Timer() : m_Start(std::chrono::high_resolution_clock::now()) {}
+
+        double ElapsedMs() const {
+            return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - m_Start).count();
+        }
+
+    private:
+        std::chrono::high_resolution_clock::time_point m_Start;
+    };
+
+}
@@ -0,0 +1,129 @@
+#include "Benchmarks.h"
+#include <ClaudeEngine/Core/Log.h>
+#include <ClaudeEngine/Renderer/FrustumCuller.h>
+#include <ClaudeEngine/Renderer/RenderCommand.h>
+#include <ClaudeEngine/Renderer/Renderer.h>
+#include <ClaudeEngine/Renderer/Shader.h>
+#include <ClaudeEngine/Renderer/StorageBuffer.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace ClaudeEngine::Benchmarks {
+
+    // std430 elements of FrustumCull.glsl
+    struct CullRecord {
+        glm::vec3 Center;
+        uint32_t Batch;
+        glm::vec3 Extents;
+        uint32_t Group;
+    };
+
+    struct DrawGroup {
+        uint32_t DrawCount;
+        uint32_t FirstCommand;
+    };
+
+    // Runs the culling kernel on random boxes in one draw group and checks every box against the
+    // scalar CPU culler. Uses its own buffers, so no renderer frame state is involved.
+    bool RunGPUCulling() {
+        const uint32_t boxCount = 16384;
+
+        if (!RenderCommand::GetCapabilities().ComputeShaders) {
+            CE_WARN("Compute shaders unavailable, skipping GPU culling validation");
+            return true;
+        }
+
+        Ref<Shader> shader = Shader::Create("assets/shaders/FrustumCull.glsl");
+        if (!shader || !shader->IsReady())
+            return false;
+
+        CameraData camera = {};
+        camera.View = glm::lookAt(glm::vec3(0.0f, 2.0f, 10.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        camera.Projection = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+        camera.ViewProjection = camera.Projection * camera.View;
+        camera.Position = glm::vec4(0.0f, 2.0f, 10.0f, 1.0f);
+        camera.NearClip = 0.1f;
+        camera.FarClip = 1000.0f;
+        Renderer::SetCameraData(camera);
+        const Frustum frustum(camera.ViewProjection);
+
+        // Deterministic boxes around the camera so both sides see the same input
+        uint32_t seed = 0x9E3779B9u;
+        auto random = [&seed](float min, float max) {
+            seed = seed * 1664525u + 1013904223u;
+            return min + (max - min) * ((seed >> 8) / 16777216.0f);
+        };
+
+        BoundsSoA bounds;
+        bounds.Reserve(boxCount);
+        for (uint32_t i = 0; i < boxCount; i++) {
+            glm::vec3 center = glm::vec3(camera.Position) + glm::vec3(random(-100.0f, 100.0f), random(-100.0f, 100.0f), random(-100.0f, 100.0f));
+            glm::vec3 extents(random(0.1f, 4.0f), random(0.1f, 4.0f), random(0.1f, 4.0f));
+            bounds.Push(AABB(center - extents, center + extents));
+        }
+
+        std::vector<uint8_t> cpuVisibility(boxCount);
+        const uint32_t cpuVisible = (uint32_t)FrustumCuller::CullScalar(frustum, bounds, cpuVisibility.data());
+
+        auto commandBuffer = StorageBuffer::Create(sizeof(DrawIndexedIndirectCommand), 1, IndirectBinding);
+        auto recordBuffer = StorageBuffer::Create(boxCount * sizeof(CullRecord), 1, CullRecordBinding);
+        auto groupBuffer = StorageBuffer::Create(sizeof(DrawGroup), 1, DrawGroupBinding);
+        auto statsBuffer = StorageBuffer::Create(sizeof(uint32_t), 1, CullStatsBinding);
+        auto visibleBuffer = StorageBuffer::CreateGPUOnly(boxCount * sizeof(DrawIndexedIndirectCommand), VisibleCommandBinding);
+
+        // Everything goes into one group of one batch
+        auto* commands = (DrawIndexedIndirectCommand*)commandBuffer->Allocate(sizeof(DrawIndexedIndirectCommand));
+        commands[0] = { 36, boxCount, 0, 0, 0 };
+        auto* records = (CullRecord*)recordBuffer->Allocate(boxCount * sizeof(CullRecord));
+        for (uint32_t i = 0; i < boxCount; i++) {
+            records[i].Center = glm::vec3(bounds.CenterX[i], bounds.CenterY[i], bounds.CenterZ[i]);
+            records[i].Extents = glm::vec3(bounds.ExtentX[i], bounds.ExtentY[i], bounds.ExtentZ[i]);
+            records[i].Batch = 0;
+            records[i].Group = 0;
+        }
+        auto* groups = (DrawGroup*)groupBuffer->Allocate(sizeof(DrawGroup));
+        groups[0] = { 0, 0 };
+        *(uint32_t*)statsBuffer->Allocate(sizeof(uint32_t)) = 0;
+        visibleBuffer->Allocate(boxCount * sizeof(DrawIndexedIndirectCommand));
+        DrainGLErrors();
+
+        shader->Bind();
+        for (int side = 0; side < Frustum::Count; side++) {
+            const Plane& plane = frustum.GetPlane((Frustum::Side)side);
+            shader->SetFloat4("u_FrustumPlanes[" + std::to_string(side) + "]", glm::vec4(plane.Normal, plane.Distance));
+        }
+        shader->SetInt("u_RecordCount", (int)boxCount);
+        shader->SetInt("u_OcclusionCulling", 0);
+        RenderCommand::DispatchCompute((boxCount + 63) / 64);
+        RenderCommand::InsertMemoryBarrier(RenderAPI::ReadbackBarrier);
+
+        DrawGroup group = {};
+        groupBuffer->GetData(&group, sizeof(DrawGroup));
+        const uint32_t gpuVisible = std::min(group.DrawCount, boxCount);
+
+        // Each surviving command carries its record index as BaseInstance
+        std::vector<DrawIndexedIndirectCommand> visibleCommands(gpuVisible);
+        if (gpuVisible)
+            visibleBuffer->GetData(visibleCommands.data(), gpuVisible * sizeof(DrawIndexedIndirectCommand));
+        bool passed = CheckGLErrors("cull dispatch");
+
+        std::vector<uint8_t> gpuVisibility(boxCount, 0);
+        for (const auto& command : visibleCommands) {
+            if (command.BaseInstance < boxCount)
+                gpuVisibility[command.BaseInstance]++;
+        }
+
+        uint32_t mismatches = 0;
+        for (uint32_t i = 0; i < boxCount; i++)
+            mismatches += gpuVisibility[i] != cpuVisibility[i];
+        Renderer::EndFrame();
+
+        CE_INFO("GPU culling, ", boxCount, " boxes: CPU ", cpuVisible, " / GPU ", gpuVisible, " visible");
+        if (mismatches)
+            CE_ERROR("  ", mismatches, " boxes disagree with the scalar culler");
+        return passed && mismatches == 0 && gpuVisible == cpuVisible;
+    }
+
+}
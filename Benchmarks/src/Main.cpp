@@ -0,0 +1,94 @@
+#include "Benchmarks.h"
+#include <ClaudeEngine/Core/Log.h>
+#include <ClaudeEngine/Core/JobSystem.h>
+#include <ClaudeEngine/Platform/Window.h>
+#include <ClaudeEngine/Renderer/Renderer.h>
+#include <ClaudeEngine/Renderer/Renderer3D.h>
+#include <glad/glad.h>
+#include <string>
+#include <vector>
+
+using namespace ClaudeEngine;
+
+namespace {
+
+    struct Suite {
+        const char* Name;
+        bool NeedsRenderer; // Runs with a window, GL context and initialized renderer
+        bool (*Run)();
+    };
+
+    const Suite s_Suites[] = {
+        { "spatial", false, Benchmarks::RunSpatial },
+        { "uniforms", true, Benchmarks::RunUniforms },
+        { "materials", true, Benchmarks::RunMaterials },
+        { "gpu-culling", true, Benchmarks::RunGPUCulling },
+        { "vertex-formats", true, Benchmarks::RunVertexFormats },
+        { "meshlets", true, Benchmarks::RunMeshlets },
+        { "picking", true, Benchmarks::RunPicking },
+    };
+
+}
+
+namespace ClaudeEngine::Benchmarks {
+
+    void DrainGLErrors() {
+        while (glGetError() != GL_NO_ERROR) {}
+    }
+
+    bool CheckGLErrors(const char* section) {
+        bool clean = true;
+        for (GLenum error = glGetError(); error != GL_NO_ERROR; error = glGetError()) {
+            CE_ERROR("GL error ", error, " in ", section);
+            clean = false;
+        }
+        return clean;
+    }
+
+}
+
+// Usage: ClaudeBenchmarks [suite...]; runs every suite when none is named
+int main(int argc, char** argv) {
+    Log::Init();
+
+    std::vector<const Suite*> selected;
+    for (const Suite& suite : s_Suites) {
+        bool named = argc < 2;
+        for (int i = 1; i < argc; i++)
+            named |= suite.Name == std::string(argv[i]);
+        if (named)
+            selected.push_back(&suite);
+    }
+    if (selected.empty()) {
+        CE_ERROR("No benchmark suite matches the arguments");
+        return 1;
+    }
+
+    bool needsRenderer = false;
+    for (const Suite* suite : selected)
+        needsRenderer |= suite->NeedsRenderer;
+
+    Scope<Window> window;
+    if (needsRenderer) {
+        window = Window::Create(WindowProps("Claude Engine Benchmarks", 1280, 720, false));
+        JobSystem::Init();
+        Renderer::Init();
+        Renderer3D::Init();
+    }
+
+    int failures = 0;
+    for (const Suite* suite : selected) {
+        CE_INFO("=== ", suite->Name, " ===");
+        if (!suite->Run()) {
+            CE_ERROR("Suite '", suite->Name, "' failed");
+            failures++;
+        }
+    }
+
+    if (needsRenderer) {
+        Renderer3D::Shutdown();
+        Renderer::Shutdown();
+        JobSystem::Shutdown();
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+#include "Benchmarks.h"
+#include <ClaudeEngine/Core/Log.h>
+#include <ClaudeEngine/Renderer/MeshletBuilder.h>
+#include <ClaudeEngine/Renderer/MeshPrimitives.h>
+#include <ClaudeEngine/Renderer/Model.h>
+#include <ClaudeEngine/Renderer/Renderer.h>
+#include <ClaudeEngine/Renderer/Renderer3D.h>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace ClaudeEngine::Benchmarks {
+
+    // Draws a split sphere the way the viewport does on the default CPU culling path and checks
+    // that every one of its meshlets is counted as visible or culled
+    bool RunMeshlets() {
+        Ref<Mesh> sphere = MeshPrimitives::CreateSphere(1.0f, 128, 64);
+        std::vector<Vertex> vertices = sphere->GetVertices();
+        std::vector<uint32_t> indices = sphere->GetIndices();
+        std::vector<Meshlet> meshlets = MeshletBuilder::Build(vertices, indices, MeshletBuilder::CanConeCull(vertices, indices));
+        if (meshlets.empty()) {
+            CE_ERROR("Sphere was not split into meshlets");
+            return false;
+        }
+
+        Ref<Model> model = CreateRef<Model>();
+        model->AddMesh(CreateRef<Mesh>(vertices, indices, std::vector<MeshTexture>(), std::vector<std::vector<uint32_t>>(),
+                                       VertexFormat::Standard, meshlets));
+
+        RenderView view;
+        view.CameraPosition = glm::vec3(0.0f, 0.0f, 5.0f);
+        view.ViewMatrix = glm::lookAt(view.CameraPosition, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        view.ProjectionMatrix = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, view.NearClip, view.FarClip);
+        view.ViewProjectionMatrix = view.ProjectionMatrix * view.ViewMatrix;
+        view.ViewFrustum.Update(view.ViewProjectionMatrix);
+
+        const bool gpuCulling = Renderer3D::IsGPUCullingActive();
+        const bool meshletCulling = Renderer3D::IsMeshletCullingEnabled();
+        Renderer3D::SetGPUCulling(false);
+        Renderer3D::SetMeshletCulling(true);
+
+        const glm::mat4 transform(1.0f);
+        Renderer3D::BeginScene(view);
+        Renderer3D::DrawModel(model, transform, nullptr, model->GetBoundingBox().Transform(transform));
+        Renderer3D::EndScene();
+        const Renderer3D::Statistics stats = Renderer3D::GetStats();
+        Renderer::EndFrame();
+
+        Renderer3D::SetGPUCulling(gpuCulling);
+        Renderer3D::SetMeshletCulling(meshletCulling);
+
+        const uint32_t counted = stats.VisibleMeshlets + stats.FrustumCulledMeshlets + stats.BackfaceCulledMeshlets;
+        CE_INFO("Meshlets, ", meshlets.size(), " clusters: ", stats.VisibleMeshlets, " visible, ",
+                stats.FrustumCulledMeshlets, " outside, ", stats.BackfaceCulledMeshlets, " back-facing");
+        if (stats.VisibleMeshlets == 0 || counted != (uint32_t)meshlets.size()) {
+            CE_ERROR("  Expected all ", meshlets.size(), " meshlets counted with some visible, got ", counted);
+            return false;
+        }
+        return true;
+    }
+
+}
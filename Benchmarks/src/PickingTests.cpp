@@ -0,0 +1,87 @@
+#include "Benchmarks.h"
+#include <ClaudeEngine/Core/Log.h>
+#include <ClaudeEngine/Renderer/Framebuffer.h>
+#include <ClaudeEngine/Renderer/MeshPrimitives.h>
+#include <ClaudeEngine/Renderer/Model.h>
+#include <ClaudeEngine/Renderer/RenderCommand.h>
+#include <ClaudeEngine/Renderer/Renderer.h>
+#include <ClaudeEngine/Renderer/Renderer3D.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace ClaudeEngine::Benchmarks {
+
+    // Renders two cubes into an entity ID target and reads it back asynchronously: a single pixel
+    // over each cube, and the whole target as a marquee region
+    bool RunPicking() {
+        const uint32_t size = 256;
+        const int leftID = 7;
+        const int rightID = 42;
+
+        FramebufferSpecification spec;
+        spec.Width = size;
+        spec.Height = size;
+        spec.Attachments = { FramebufferTextureFormat::RED_INTEGER, FramebufferTextureFormat::Depth };
+        Ref<Framebuffer> framebuffer = Framebuffer::Create(spec);
+
+        Ref<Model> cube = CreateRef<Model>();
+        cube->AddMesh(MeshPrimitives::CreateCube(1.0f));
+
+        RenderView view;
+        view.CameraPosition = glm::vec3(0.0f, 0.0f, 5.0f);
+        view.ViewMatrix = glm::lookAt(view.CameraPosition, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        view.ProjectionMatrix = glm::perspective(glm::radians(45.0f), 1.0f, view.NearClip, view.FarClip);
+        view.ViewProjectionMatrix = view.ProjectionMatrix * view.ViewMatrix;
+        view.ViewFrustum.Update(view.ViewProjectionMatrix);
+
+        DrainGLErrors();
+        framebuffer->Bind();
+        RenderCommand::Clear();
+        framebuffer->ClearAttachment(0, -1);
+        Renderer3D::BeginScene(view);
+        Renderer3D::DrawEntityID(cube, glm::translate(glm::mat4(1.0f), glm::vec3(-1.0f, 0.0f, 0.0f)), leftID);
+        Renderer3D::DrawEntityID(cube, glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 0.0f, 0.0f)), rightID);
+        Renderer3D::EndScene();
+        framebuffer->Unbind();
+
+        // Quarter and three quarters across, halfway up: the cube centers
+        int leftPick = -2, rightPick = -2;
+        std::vector<int> marquee;
+        framebuffer->ReadPixelAsync(0, size / 4, size / 2, [&leftPick](int id) { leftPick = id; });
+        framebuffer->ReadPixelAsync(0, size * 3 / 4, size / 2, [&rightPick](int id) { rightPick = id; });
+        framebuffer->ReadPixelsAsync(0, 0, 0, size, size, [&marquee](const PixelReadback& readback) {
+            marquee = readback.GetUniqueValues();
+        });
+        bool passed = CheckGLErrors("entity ID pass and readback");
+
+        Timer timer;
+        uint32_t polls = 0;
+        while (framebuffer->GetPendingReadbacks() > 0 && timer.ElapsedMs() < 2000.0) {
+            framebuffer->PollReadbacks();
+            polls++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        Renderer::EndFrame();
+
+        if (framebuffer->GetPendingReadbacks() > 0) {
+            CE_ERROR("Readbacks still pending after ", timer.ElapsedMs(), " ms");
+            return false;
+        }
+
+        std::sort(marquee.begin(), marquee.end());
+        CE_INFO("Picking, ", polls, " polls in ", timer.ElapsedMs(), " ms: left ", leftPick, ", right ", rightPick,
+                ", marquee ", marquee.size(), " entities");
+        if (leftPick != leftID || rightPick != rightID) {
+            CE_ERROR("  Expected IDs ", leftID, " and ", rightID);
+            passed = false;
+        }
+        if (marquee != std::vector<int>{ leftID, rightID }) {
+            CE_ERROR("  Marquee should hold exactly both IDs");
+            passed = false;
+        }
+        return passed;
+    }
+
+}
@@ -0,0 +1,111 @@
+#include "Benchmarks.h"
+#include <ClaudeEngine/Core/Log.h>
+#include <ClaudeEngine/Renderer/FrustumCuller.h>
+#include <ClaudeEngine/Scene/DynamicAABBTree.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace ClaudeEngine::Benchmarks {
+
+    // Batched SoA kernel against Frustum::Intersects per box; both must agree on every box
+    static bool RunFrustumCuller(size_t boxCount) {
+        std::mt19937 rng(1337);
+        std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> size(0.1f, 5.0f);
+
+        std::vector<AABB> boxes;
+        boxes.reserve(boxCount);
+        BoundsSoA soa;
+        soa.Reserve(boxCount);
+        for (size_t i = 0; i < boxCount; i++) {
+            glm::vec3 center(position(rng), position(rng), position(rng));
+            glm::vec3 extents(size(rng), size(rng), size(rng));
+            boxes.emplace_back(center - extents, center + extents);
+            soa.Push(boxes.back());
+        }
+
+        const glm::mat4 projection = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+        const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 2.0f, 10.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        const Frustum frustum(projection * view);
+
+        std::vector<uint8_t> expected(boxCount);
+        Timer naiveTimer;
+        for (size_t i = 0; i < boxCount; i++)
+            expected[i] = frustum.Intersects(boxes[i]) ? 1 : 0;
+        double naiveMs = naiveTimer.ElapsedMs();
+
+        std::vector<uint8_t> visibility(boxCount);
+        Timer kernelTimer;
+        size_t visibleCount = FrustumCuller::Cull(frustum, soa, visibility.data());
+        double kernelMs = kernelTimer.ElapsedMs();
+
+        size_t mismatches = 0;
+        for (size_t i = 0; i < boxCount; i++)
+            mismatches += expected[i] != visibility[i];
+
+        CE_INFO("Frustum culling, ", boxCount, " boxes (", FrustumCuller::GetKernelName(), " kernel)");
+        CE_INFO("  Naive: ", naiveMs, " ms");
+        CE_INFO("  Batched: ", kernelMs, " ms (", visibleCount, " visible)");
+        if (mismatches)
+            CE_ERROR("  ", mismatches, " boxes disagree with Frustum::Intersects");
+        return mismatches == 0;
+    }
+
+    static bool RunAABBTree(size_t proxyCount) {
+        std::mt19937 rng(1337);
+        float worldSize = 10.0f * std::cbrt((float)proxyCount);
+        std::uniform_real_distribution<float> position(-worldSize, worldSize);
+        std::uniform_real_distribution<float> step(-0.2f, 0.2f);
+
+        std::vector<glm::vec3> centers(proxyCount);
+        for (auto& center : centers)
+            center = glm::vec3(position(rng), position(rng), position(rng));
+
+        DynamicAABBTree tree;
+        std::vector<int32_t> proxies(proxyCount);
+        const glm::vec3 halfSize(0.5f);
+
+        Timer insertTimer;
+        for (size_t i = 0; i < proxyCount; i++)
+            proxies[i] = tree.CreateProxy(AABB(centers[i] - halfSize, centers[i] + halfSize), (uint32_t)i);
+        double insertMs = insertTimer.ElapsedMs();
+
+        // Every proxy moved once
+        uint32_t reinserted = 0;
+        Timer updateTimer;
+        for (size_t i = 0; i < proxyCount; i++) {
+            glm::vec3 displacement(step(rng), step(rng), step(rng));
+            centers[i] += displacement;
+            if (tree.MoveProxy(proxies[i], AABB(centers[i] - halfSize, centers[i] + halfSize), displacement))
+                reinserted++;
+        }
+        double updateMs = updateTimer.ElapsedMs();
+
+        size_t queryHits = 0;
+        Timer queryTimer;
+        for (int i = 0; i < 1000; i++) {
+            glm::vec3 center(position(rng), position(rng), position(rng));
+            tree.Query(AABB(center - glm::vec3(5.0f), center + glm::vec3(5.0f)), [&](int32_t) {
+                queryHits++;
+                return true;
+            });
+        }
+        double queryMs = queryTimer.ElapsedMs();
+
+        CE_INFO("AABB tree, ", proxyCount, " proxies (height ", tree.GetHeight(), ")");
+        CE_INFO("  Insert: ", insertMs, " ms");
+        CE_INFO("  Update: ", updateMs, " ms (", reinserted, " reinserted)");
+        CE_INFO("  1000 queries: ", queryMs, " ms (", queryHits, " hits)");
+        return tree.GetProxyCount() == proxyCount;
+    }
+
+    bool RunSpatial() {
+        bool passed = RunFrustumCuller(1000000);
+        for (size_t proxyCount : { 10000, 100000, 1000000 })
+            passed &= RunAABBTree(proxyCount);
+        return passed;
+    }
+
+}
@@ -0,0 +1,78 @@
+#include "Benchmarks.h"
+#include <ClaudeEngine/Core/Log.h>
+#include <ClaudeEngine/Renderer/GeometryPool.h>
+#include <ClaudeEngine/Renderer/Mesh.h>
+#include <ClaudeEngine/Renderer/MeshPrimitives.h>
+#include <ClaudeEngine/Renderer/RenderCommand.h>
+#include <ClaudeEngine/Renderer/Shader.h>
+#include <ClaudeEngine/Renderer/VertexFormat.h>
+#include <glad/glad.h>
+
+namespace ClaudeEngine::Benchmarks {
+
+    // Vertex memory and GPU vertex-stage time for a dense sphere in each VertexFormat. Triangles
+    // are shrunk below a pixel so the timing is dominated by fetching and decoding attributes.
+    bool RunVertexFormats() {
+        const uint32_t draws = 100;
+
+        Ref<Shader> shader = Shader::Create("assets/shaders/VertexFetch.glsl");
+        if (!shader || !shader->IsReady())
+            return false;
+        const UniformHandle vertexFormatHandle = Shader::GetUniformHandle("u_VertexFormat");
+
+        // Dense enough that vertex work dominates per-draw overhead
+        Ref<Mesh> source = MeshPrimitives::CreateSphere(1.0f, 512, 256);
+        const uint32_t poolPages = GeometryPool::GetStats().Pages;
+
+        // Collapses the sphere to a few pixels so the fragment stage stays idle
+        glm::mat4 shrink(1.0f);
+        shrink[0][0] = shrink[1][1] = shrink[2][2] = 1e-4f;
+        shader->Bind();
+        shader->SetMat4(Shader::GetUniformHandle("u_Transform"), shrink);
+        RenderCommand::SetDepthTest(false);
+        RenderCommand::SetColorWrite(false);
+        DrainGLErrors();
+
+        CE_INFO("Vertex formats, ", source->GetVertexCount(), " vertices x ", draws, " draws");
+        GLuint query = 0;
+        glCreateQueries(GL_TIME_ELAPSED, 1, &query);
+        for (uint32_t i = 0; i < VertexFormatCount; i++) {
+            VertexFormat format = (VertexFormat)i;
+            // Scoped so its pool page is released before the next format allocates one
+            Mesh mesh(source->GetVertices(), source->GetIndices(), {}, {}, format);
+            if (!mesh.GetVertexArray())
+                continue;
+
+            shader->SetInt(vertexFormatHandle, (int)format);
+            const Ref<VertexArray>& vertexArray = mesh.GetVertexArray();
+            vertexArray->Bind();
+            // Untimed first draw pays for any upload or residency work
+            RenderCommand::DrawIndexed(vertexArray, mesh.GetIndexCount(), mesh.GetFirstIndex(), mesh.GetBaseVertex());
+
+            glBeginQuery(GL_TIME_ELAPSED, query);
+            for (uint32_t draw = 0; draw < draws; draw++)
+                RenderCommand::DrawIndexed(vertexArray, mesh.GetIndexCount(), mesh.GetFirstIndex(), mesh.GetBaseVertex());
+            glEndQuery(GL_TIME_ELAPSED);
+
+            // Blocks until the GPU is done
+            GLuint64 elapsedNs = 0;
+            glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsedNs);
+
+            const uint32_t stride = GetVertexFormatStride(format);
+            const double vertexMB = (double)stride * mesh.GetVertexCount() / (1024.0 * 1024.0);
+            CE_INFO("  ", VertexFormatToString(format), ": ", stride, " B/vertex, ", vertexMB, " MB, ", elapsedNs / 1e6, " ms GPU");
+        }
+        glDeleteQueries(1, &query);
+
+        RenderCommand::SetColorWrite(true);
+        RenderCommand::SetDepthTest(true);
+        bool passed = CheckGLErrors("vertex format draws");
+
+        if (GeometryPool::GetStats().Pages != poolPages) {
+            CE_ERROR("Geometry pool kept ", GeometryPool::GetStats().Pages - poolPages, " pages after the meshes were freed");
+            passed = false;
+        }
+        return passed;
+    }
+
+}
@@ -4,10 +4,12 @@
 #include "ClaudeEngine/Renderer/EditorCamera.h"
 #include "ClaudeEngine/Renderer/Shader.h"
 #include "ClaudeEngine/Renderer/VertexArray.h"
+#include "ClaudeEngine/Renderer/FramePipeline.h"
 #include "ClaudeEngine/Scene/Scene.h"
 #include "ClaudeEngine/Scene/Entity.h"
 #include <glm/glm.hpp>
 #include <memory>
+#include <vector>
 
 namespace ClaudeEngine {
 
@@ -25,9 +27,14 @@ namespace ClaudeEngine {
 
         void OnUpdate(float deltaTime);
         void OnImGuiRender();
+        // Call once every panel is done with the scene for the frame; starts the next pipelined snapshot
+        void OnPanelsRendered();
         void OnEvent(class Event& e);
         void SetContext(std::shared_ptr<Scene> scene) { m_Scene = scene; }
         void SetSelectedEntity(Entity entity) { m_SelectedEntity = entity; }
+        Entity GetSelectedEntity() const { return m_SelectedEntity; }
+        // True for the frame in which a click in the viewport changed the selection
+        bool WasEntityPicked() const { return m_EntityPicked; }
 
         std::shared_ptr<Framebuffer> GetFramebuffer() const { return m_Framebuffer; }
         void SetFramebuffer(std::shared_ptr<Framebuffer> framebuffer) { m_Framebuffer = framebuffer; }
@@ -39,16 +46,20 @@ namespace ClaudeEngine {
         GizmoOperation GetGizmoOperation() const { return m_GizmoOperation; }
 
         EditorCamera& GetEditorCamera() { return m_EditorCamera; }
+        FramePipeline& GetFramePipeline() { return m_Pipeline; }
 
     private:
         void RenderGizmos();
         void RenderGrid();
-        void RenderScene();
+        // Culls and records the scene without touching GL, so it may run on the pipeline's producer
+        void PrepareSnapshot(RenderSnapshot& snapshot, const std::shared_ptr<Scene>& scene, const RenderView& view);
+        void DrawSnapshot(RenderSnapshot& snapshot);
 
     private:
         std::shared_ptr<Framebuffer> m_Framebuffer;
         std::shared_ptr<Scene> m_Scene;
         Entity m_SelectedEntity;
+        bool m_EntityPicked = false;
 
         glm::vec2 m_ViewportSize = { 0, 0 };
         glm::vec2 m_ViewportBounds[2];
@@ -59,6 +70,15 @@ namespace ClaudeEngine {
         // Editor camera
         EditorCamera m_EditorCamera;
 
+        // Per-entity results of the batched frustum cull, indexed like the scene bounds cache.
+        // Scratch for PrepareSnapshot, which never runs twice at once.
+        std::vector<uint8_t> m_Visibility;
+        // Entities the CPU culls; with GPU culling, models with bounds are left to the cull pass
+        std::vector<uint8_t> m_CPUCullable;
+        // Entities drawn in the prepared frame's occluder pre-pass, same indexing
+        std::vector<uint8_t> m_Occluders;
+        static constexpr uint32_t RecordGrainSize = 512; // Entities per record job
+
         // Grid rendering
         std::shared_ptr<Shader> m_GridShader;
         std::shared_ptr<VertexArray> m_GridVAO;
@@ -66,6 +86,9 @@ namespace ClaudeEngine {
         GizmoOperation m_GizmoOperation = GizmoOperation::Translate;
         bool m_SnapEnabled = false;
         float m_SnapValues[3] = { 0.5f, 15.0f, 0.1f }; // Translate, Rotate, Scale
+
+        // Last so its producer is joined before anything it reads goes away
+        FramePipeline m_Pipeline;
     };
 
 }
@@ -68,8 +68,9 @@ public:
             // Try to load shader from file (optional, fallback to simple shader)
             CE_INFO("Loading shader...");
             try {
-                m_Shader = ClaudeEngine::Shader::Create("assets/shaders/PBR_RayTracing.glsl");
-                CE_INFO("Shader loaded successfully from file");
+                // Compiles while the rest of the editor starts; the renderer draws a fallback until then
+                m_Shader = ClaudeEngine::Shader::CreateAsync("assets/shaders/PBR_RayTracing.glsl");
+                CE_INFO("Shader compile started");
             } catch (...) {
                 CE_WARN("Could not load shader from file, using simple shader");
                 CreateFallbackShader();
@@ -94,6 +95,7 @@ public:
             m_SettingsPanel = ClaudeEngine::CreateScope<ClaudeEngine::SettingsPanel>();
             m_StatsPanel = ClaudeEngine::CreateScope<ClaudeEngine::StatsPanel>();
             m_ViewportPanel = ClaudeEngine::CreateScope<ClaudeEngine::ViewportPanel>();
+            m_StatsPanel->SetFramePipeline(&m_ViewportPanel->GetFramePipeline());
             
             // Create framebuffer for viewport
             CE_INFO("Creating framebuffer...");
@@ -120,6 +122,8 @@ public:
     
     ~EditorLayer() {
         CE_INFO("Shutting down editor systems...");
+        // Joins the viewport's frame producer before the renderer it records for goes away
+        m_ViewportPanel.reset();
         ClaudeEngine::IconManager::Shutdown();
         ClaudeEngine::Renderer3D::Shutdown();
     }
@@ -133,18 +137,34 @@ public:
             layout(location = 1) in vec3 a_Normal;
             layout(location = 2) in vec2 a_TexCoords;
             
-            uniform mat4 u_ViewProjection;
-            uniform mat4 u_Transform;
+            layout(std140, binding = 0) uniform Camera {
+                mat4 u_ViewProjection;
+                mat4 u_View;
+                mat4 u_Projection;
+                vec4 u_CameraPosition;
+                float u_Near;
+                float u_Far;
+            };
+            
+            struct InstanceData {
+                mat4 Transform;
+                vec4 Color;
+            };
+            
+            layout(std430, binding = 1) readonly buffer Instances {
+                InstanceData u_Instances[];
+            };
             
             out vec3 v_Normal;
             out vec2 v_TexCoords;
             out vec3 v_FragPos;
             
             void main() {
-                v_Normal = mat3(transpose(inverse(u_Transform))) * a_Normal;
+                mat4 transform = u_Instances[gl_BaseInstance + gl_InstanceID].Transform;
+                v_Normal = mat3(transpose(inverse(transform))) * a_Normal;
                 v_TexCoords = a_TexCoords;
-                v_FragPos = vec3(u_Transform * vec4(a_Position, 1.0));
-                gl_Position = u_ViewProjection * u_Transform * vec4(a_Position, 1.0);
+                v_FragPos = vec3(transform * vec4(a_Position, 1.0));
+                gl_Position = u_ViewProjection * transform * vec4(a_Position, 1.0);
             }
         )";
 
@@ -248,11 +268,11 @@ public:
 
         // TODO: Render scene using ECS
         // For now, just setup render state
-        if (m_Shader) {
+        // Binding before the compile finishes would wait for it
+        if (m_Shader && m_Shader->IsReady()) {
             m_Shader->Bind();
             m_Shader->SetFloat3("u_LightPos", { 5.0f, 5.0f, 5.0f });
             m_Shader->SetFloat3("u_ViewPos", m_Camera->GetPosition());
-            m_Shader->SetMat4("u_ViewProjection", m_Camera->GetViewProjection());
         }
 
         ClaudeEngine::Renderer::EndScene();
@@ -362,6 +382,9 @@ public:
 
         // Viewport (always show)
         m_ViewportPanel->OnImGuiRender();
+        // The hierarchy owns the selection; viewport picks go through it
+        if (m_ViewportPanel->WasEntityPicked() && m_HierarchyPanel)
+            m_HierarchyPanel->SetSelectedEntity(m_ViewportPanel->GetSelectedEntity());
 
         // Render panels
         if (m_ShowHierarchy) {
@@ -401,6 +424,9 @@ public:
                 ImGui::EndPopup();
             }
         }
+
+        // Every panel has had its turn with the scene
+        m_ViewportPanel->OnPanelsRendered();
     }
 
     void LoadModel(const std::string& path) {
@@ -484,6 +510,7 @@ public:
             model->AddMesh(mesh);
             meshRenderer.ModelAsset = model;
             meshRenderer.MaterialOverride = m_DefaultMaterial;
+            meshRenderer.CalculateBoundingBox();
         }
     }
 
@@ -1,5 +1,11 @@
 #include "EditorPanels.h"
 #include "ClaudeEngine/Scene/Components.h"
+#include "ClaudeEngine/Renderer/Renderer3D.h"
+#include "ClaudeEngine/Renderer/Renderer.h"
+#include "ClaudeEngine/Renderer/Model.h"
+#include "ClaudeEngine/Renderer/GeometryPool.h"
+#include "ClaudeEngine/Renderer/FramePipeline.h"
+#include "ClaudeEngine/Core/JobSystem.h"
 #include <imgui.h>
 #include <glm/gtc/type_ptr.hpp>
 #include <filesystem>
@@ -317,6 +323,7 @@ namespace ClaudeEngine {
             
             ImGui::Checkbox("Cast Shadows", &mrc.CastShadows);
             ImGui::Checkbox("Receive Shadows", &mrc.ReceiveShadows);
+            ImGui::Checkbox("Frustum Culling", &mrc.FrustumCulling);
             
             // Model path drag-drop
             ImGui::Text("Model: %s", mrc.ModelAsset ? "Loaded" : "None");
@@ -458,9 +465,117 @@ namespace ClaudeEngine {
         ImGui::Spacing();
         ImGui::Text("Rendering");
         ImGui::Separator();
-        ImGui::Text("Draw Calls: %d", m_DrawCalls);
-        ImGui::Text("Vertices: %d", m_Vertices);
-        ImGui::Text("Triangles: %d", m_Triangles);
+        auto stats = Renderer3D::GetStats();
+        ImGui::Text("Draw Calls: %u", stats.DrawCalls);
+        ImGui::Text("Indirect Commands: %u", stats.IndirectCommands);
+        ImGui::Text("Submitted Vertices: %u", stats.Vertices);
+        ImGui::Text("Submitted Triangles: %u", stats.Triangles);
+
+        ImGui::Spacing();
+        ImGui::Text("Render Queue");
+        ImGui::Separator();
+        ImGui::Text("Packets: %u", stats.SubmittedPackets);
+        ImGui::Text("Command Lists: %u (%u record threads)", stats.CommandLists, JobSystem::GetThreadCount());
+        ImGui::Text("Submitted Instances: %u", stats.Instances);
+        ImGui::Text("Shader Binds: %u", stats.ShaderBinds);
+        ImGui::Text("Material Binds: %u", stats.MaterialBinds);
+        ImGui::Text("Fallback Draws: %u", stats.FallbackDraws);
+        const auto& failedShaders = Renderer3D::GetFailedShaders();
+        if (!failedShaders.empty()) {
+            ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Failed Shaders: %zu (see log)", failedShaders.size());
+            for (const auto& name : failedShaders)
+                ImGui::BulletText("%s", name.c_str());
+        }
+        ImGui::Text("Vertex Array Binds: %u", stats.VertexArrayBinds);
+        ImGui::Text("State Changes Avoided: %u", stats.StateChangesAvoided);
+
+        ImGui::Spacing();
+        ImGui::Text("GL State");
+        ImGui::Separator();
+        uint32_t stateCalls = stats.StateCallsIssued + stats.StateCallsFiltered;
+        ImGui::Text("Issued: %u", stats.StateCallsIssued);
+        ImGui::Text("Filtered: %u (%.1f%%)", stats.StateCallsFiltered,
+            stateCalls ? 100.0f * stats.StateCallsFiltered / stateCalls : 0.0f);
+
+        ImGui::Spacing();
+        ImGui::Text("Culling");
+        ImGui::Separator();
+        ImGui::Text("Visible: %u", stats.VisibleObjects);
+        ImGui::Text("Culled: %u", stats.CulledObjects);
+        ImGui::Text("Kernel: %s", FrustumCuller::GetKernelName());
+
+        if (Renderer3D::IsGPUCullingSupported()) {
+            bool gpuCulling = Renderer3D::IsGPUCullingActive();
+            if (ImGui::Checkbox("GPU Culling", &gpuCulling))
+                Renderer3D::SetGPUCulling(gpuCulling);
+            if (gpuCulling)
+                ImGui::TextDisabled("Opaque models are culled on the GPU");
+        } else {
+            ImGui::TextDisabled("GPU culling unsupported");
+        }
+
+        if (Renderer3D::IsOcclusionCullingSupported()) {
+            bool occlusion = Renderer3D::IsOcclusionCullingActive();
+            if (ImGui::Checkbox("Occlusion Culling", &occlusion))
+                Renderer3D::SetOcclusionCulling(occlusion);
+            if (occlusion) {
+                ImGui::Text("Occluders: %u", stats.Occluders);
+                ImGui::Text("Occluded: %u", stats.OccludedObjects);
+                if (!Renderer3D::IsGPUCullingActive())
+                    ImGui::TextDisabled("CPU tests use a Hi-Z readback a few frames old");
+            }
+        } else {
+            ImGui::TextDisabled("Occlusion culling unsupported");
+        }
+
+        bool meshletCulling = Renderer3D::IsMeshletCullingEnabled();
+        if (ImGui::Checkbox("Meshlet Culling", &meshletCulling))
+            Renderer3D::SetMeshletCulling(meshletCulling);
+        if (meshletCulling) {
+            ImGui::Text("Meshlets Visible: %u", stats.VisibleMeshlets);
+            ImGui::Text("Outside Frustum: %u", stats.FrustumCulledMeshlets);
+            ImGui::Text("Back-facing: %u", stats.BackfaceCulledMeshlets);
+        }
+        bool importMeshlets = Model::GetImportMeshlets();
+        if (ImGui::Checkbox("Build Meshlets on Import", &importMeshlets))
+            Model::SetImportMeshlets(importMeshlets);
+
+        ImGui::Spacing();
+        ImGui::Text("Vertex Format");
+        ImGui::Separator();
+        auto poolStats = GeometryPool::GetStats();
+        ImGui::Text("Vertex Memory: %.2f MB (%u vertices)", poolStats.UsedVertexBytes / (1024.0 * 1024.0), poolStats.UsedVertices);
+
+        int importFormat = (int)Model::GetImportVertexFormat();
+        const char* formatNames[VertexFormatCount];
+        for (uint32_t i = 0; i < VertexFormatCount; i++)
+            formatNames[i] = VertexFormatToString((VertexFormat)i);
+        if (ImGui::Combo("Import Format", &importFormat, formatNames, (int)VertexFormatCount))
+            Model::SetImportVertexFormat((VertexFormat)importFormat);
+        ImGui::TextDisabled("Applies to models loaded afterwards");
+
+        ImGui::Spacing();
+        ImGui::Text("Streaming");
+        ImGui::Separator();
+        const auto& streamStats = Renderer::GetStreamBuffer()->GetStats();
+        ImGui::Text("Frame: %.1f KB of %.1f MB (peak %.1f KB)", streamStats.FrameBytes / 1024.0,
+            streamStats.Size / (1024.0 * 1024.0), streamStats.PeakFrameBytes / 1024.0);
+        ImGui::Text("Wraps: %u", streamStats.Wraps);
+        ImGui::Text("Stalls: %u", streamStats.Stalls);
+
+        if (m_FramePipeline) {
+            ImGui::Spacing();
+            ImGui::Text("Frame Pipeline");
+            ImGui::Separator();
+            bool pipelined = m_FramePipeline->IsPipelined();
+            if (ImGui::Checkbox("Pipelined (throughput over latency)", &pipelined))
+                m_FramePipeline->SetPipelined(pipelined);
+            const auto& timings = m_FramePipeline->GetTimings();
+            ImGui::Text("Prepare: %.3f ms (%s)", timings.PrepareMs, timings.LatencyFrames > 0 ? "producer thread" : "inline");
+            ImGui::Text("Wait: %.3f ms", timings.WaitMs);
+            ImGui::Text("Submit: %.3f ms", timings.SubmitMs);
+            ImGui::Text("Latency: %u frame(s)", timings.LatencyFrames);
+        }
 
         ImGui::End();
     }
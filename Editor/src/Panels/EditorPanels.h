@@ -4,6 +4,7 @@
 #include "ClaudeEngine/Scene/Scene.h"
 #include "ClaudeEngine/Scene/Entity.h"
 #include "ClaudeEngine/Renderer/Framebuffer.h"
+#include "ClaudeEngine/Renderer/Renderer3D.h"
 #include <imgui.h>
 #include <functional>
 #include <filesystem>
@@ -11,6 +12,8 @@
 
 namespace ClaudeEngine {
 
+    class FramePipeline;
+
     // ========== HIERARCHY PANEL ==========
     class HierarchyPanel {
     public:
@@ -120,13 +123,13 @@ namespace ClaudeEngine {
         StatsPanel() = default;
 
         void OnImGuiRender();
+        // The viewport's pipeline, for the latency/throughput toggle and stage timings
+        void SetFramePipeline(FramePipeline* pipeline) { m_FramePipeline = pipeline; }
 
     private:
         // Performance metrics
         float m_FrameTime = 0.0f;
-        int m_DrawCalls = 0;
-        int m_Vertices = 0;
-        int m_Triangles = 0;
+        FramePipeline* m_FramePipeline = nullptr;
     };
 
 }
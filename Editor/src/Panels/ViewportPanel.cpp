@@ -4,10 +4,12 @@
 #include "ClaudeEngine/Renderer/Renderer3D.h"
 #include "ClaudeEngine/Renderer/Model.h"
 #include "ClaudeEngine/Core/Log.h"
+#include "ClaudeEngine/Core/JobSystem.h"
 #include <imgui.h>
 #include <ImGuizmo.h>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
 #include <glm/gtx/matrix_decompose.hpp>
 #include <glm/gtx/quaternion.hpp>
 
@@ -18,11 +20,15 @@ namespace ClaudeEngine {
         FramebufferSpecification fbSpec;
         fbSpec.Width = 1280;
         fbSpec.Height = 720;
-        fbSpec.Attachments = { FramebufferTextureFormat::RGBA8, FramebufferTextureFormat::RED_INTEGER, FramebufferTextureFormat::Depth };
+        // Picking ray casts against the scene, so there is no entity ID attachment
+        fbSpec.Attachments = { FramebufferTextureFormat::RGBA8, FramebufferTextureFormat::Depth };
         m_Framebuffer = Framebuffer::Create(fbSpec);
     }
 
     void ViewportPanel::OnUpdate(float deltaTime) {
+        // A snapshot still being prepared reads the scene and camera touched below
+        m_Pipeline.Wait();
+
         // Update viewport size
         m_EditorCamera.SetViewportSize(m_ViewportSize.x, m_ViewportSize.y);
 
@@ -47,51 +53,156 @@ namespace ClaudeEngine {
 
         // Render scene to framebuffer
         if (m_ViewportSize.x > 0 && m_ViewportSize.y > 0) {
-            RenderScene();
+            m_Pipeline.Draw(
+                [this](RenderSnapshot& snapshot) { PrepareSnapshot(snapshot, m_Scene, RenderView::FromCamera(m_EditorCamera)); },
+                [this](RenderSnapshot& snapshot) { DrawSnapshot(snapshot); });
         }
     }
 
+    void ViewportPanel::OnPanelsRendered() {
+        if (!m_Pipeline.IsPipelined() || m_ViewportSize.x <= 0 || m_ViewportSize.y <= 0)
+            return;
+
+        // The UI is done with the scene for this frame; next frame's draw gets what this records
+        std::shared_ptr<Scene> scene = m_Scene;
+        RenderView view = RenderView::FromCamera(m_EditorCamera);
+        m_Pipeline.Launch([this, scene, view](RenderSnapshot& snapshot) { PrepareSnapshot(snapshot, scene, view); });
+    }
+
     void ViewportPanel::OnEvent(Event& e) {
         // Events are handled through ImGui input in OnUpdate
     }
 
-    void ViewportPanel::RenderScene() {
-        // Bind framebuffer
-        m_Framebuffer->Bind();
+    void ViewportPanel::PrepareSnapshot(RenderSnapshot& snapshot, const std::shared_ptr<Scene>& scene, const RenderView& view) {
+        snapshot.View = view;
+        snapshot.Occlusion = Renderer3D::IsOcclusionCullingActive();
+        snapshot.CommandLists.resize(std::max((size_t)JobSystem::GetThreadCount(), snapshot.CommandLists.size()));
+        for (auto& commands : snapshot.CommandLists)
+            commands.Begin(view);
 
-        // Clear
-        RenderCommand::SetClearColor({ 0.2f, 0.3f, 0.4f, 1.0f });
-        RenderCommand::Clear();
+        // Render all entities in the scene
+        if (!scene)
+            return;
 
-        // Begin 3D rendering
-        Renderer3D::BeginScene(m_EditorCamera);
+        // Record jobs only read the registry through these; creating the views here makes sure
+        // no job has to create a component pool
+        auto& registry = scene->GetRegistry();
+        auto transforms = registry.view<TransformComponent>();
+        auto meshRenderers = registry.view<MeshRendererComponent>();
+
+        // Cull the whole scene in one batch before anything is queued. The GPU cull pass only sees
+        // models drawn with bounds, so with it active everything else is still culled here.
+        RenderCommandList& mainList = snapshot.CommandLists[0];
+        scene->UpdateBoundsCache();
+        const SceneBoundsCache& cache = scene->GetBoundsCache();
+        const bool gpuCulling = Renderer3D::IsGPUCullingActive();
+        const uint8_t* cullable = cache.Cullable.data();
+        if (gpuCulling) {
+            m_CPUCullable.assign(cache.Cullable.begin(), cache.Cullable.end());
+            for (size_t i = 0; i < cache.Entities.size(); i++) {
+                if (meshRenderers.contains(cache.Entities[i]) && meshRenderers.get<MeshRendererComponent>(cache.Entities[i]).ModelAsset)
+                    m_CPUCullable[i] = 0;
+            }
+            cullable = m_CPUCullable.data();
+        }
+        mainList.CullBounds(*cache.Bounds, cullable, m_Visibility);
+
+        auto getBounds = [&cache](size_t i) {
+            const BoundsSoA& soa = *cache.Bounds;
+            glm::vec3 center(soa.CenterX[i], soa.CenterY[i], soa.CenterZ[i]);
+            glm::vec3 extents(soa.ExtentX[i], soa.ExtentY[i], soa.ExtentZ[i]);
+            return AABB(center - extents, center + extents);
+        };
+
+        const uint32_t entityCount = (uint32_t)cache.Entities.size();
+
+        // Pick each visible model's level of detail up front; the occluder pre-pass has to match it
+        JobSystem::ParallelFor(entityCount, RecordGrainSize, [&](uint32_t begin, uint32_t end, uint32_t) {
+            for (uint32_t i = begin; i < end; i++) {
+                if (!m_Visibility[i] || !meshRenderers.contains(cache.Entities[i]))
+                    continue;
+                auto& mr = meshRenderers.get<MeshRendererComponent>(cache.Entities[i]);
+                if (!mr.ModelAsset)
+                    continue;
+                const uint32_t levelCount = mr.ModelAsset->GetLODCount();
+                const uint32_t finest = std::min((uint32_t)std::max(mr.LODLevel, 0), levelCount > 0 ? levelCount - 1 : 0);
+                mr.SelectedLOD = std::max(mainList.SelectLOD(getBounds(i), mr.SelectedLOD, levelCount), finest);
+            }
+        });
+
+        // Large models go into a depth pre-pass that the Hi-Z pyramid is built from. The occluder
+        // budget is filled in entity order, so this stays on one thread.
+        m_Occluders.assign(cache.Entities.size(), 0);
+        if (snapshot.Occlusion) {
+            for (size_t i = 0; i < cache.Entities.size(); i++) {
+                if (!m_Visibility[i] || !cache.Cullable[i] || !meshRenderers.contains(cache.Entities[i]))
+                    continue;
+
+                auto& mr = meshRenderers.get<MeshRendererComponent>(cache.Entities[i]);
+                if (!mr.ModelAsset || !mr.Visible || !mainList.IsOccluderCandidate(getBounds(i)))
+                    continue;
+
+                mainList.DrawOccluder(mr.ModelAsset, transforms.get<TransformComponent>(cache.Entities[i]).GetTransform(), mr.SelectedLOD);
+                m_Occluders[i] = 1;
+            }
+        }
 
-        // Draw grid
-        Renderer3D::DrawGrid();
+        // Record the main pass across the job threads, each into its own list
+        JobSystem::ParallelFor(entityCount, RecordGrainSize, [&](uint32_t begin, uint32_t end, uint32_t thread) {
+            RenderCommandList& commands = snapshot.CommandLists[thread];
+            for (uint32_t i = begin; i < end; i++) {
+                if (!m_Visibility[i])
+                    continue;
+
+                // Tests against the latest pyramid read back to the CPU; the GPU path tests against
+                // the drawn frame's pyramid in its cull pass instead
+                if (snapshot.Occlusion && !gpuCulling && cache.Cullable[i] && !m_Occluders[i] && commands.IsOccluded(getBounds(i)))
+                    continue;
+
+                entt::entity entity = cache.Entities[i];
+                const glm::mat4 transform = transforms.get<TransformComponent>(entity).GetTransform();
 
-        // Render all entities in the scene
-        if (m_Scene) {
-            auto& registry = m_Scene->GetRegistry();
-            auto view = registry.view<TransformComponent>();
-            for (auto entityHandle : view) {
-                Entity entity{ entityHandle, m_Scene.get() };
-                
-                auto& transform = entity.GetComponent<TransformComponent>();
-                
                 // Render MeshRenderer components
-                if (entity.HasComponent<MeshRendererComponent>()) {
-                    auto& mr = entity.GetComponent<MeshRendererComponent>();
+                if (meshRenderers.contains(entity)) {
+                    auto& mr = meshRenderers.get<MeshRendererComponent>(entity);
                     if (mr.ModelAsset && mr.Visible) {
-                        Renderer3D::DrawModel(mr.ModelAsset, transform.GetTransform());
+                        // Bounds drive meshlet culling on either path; with GPU culling active the
+                        // CPU pass above skipped these, so the GPU pass has to cull them
+                        AABB worldBounds;
+                        if (cache.Cullable[i])
+                            worldBounds = getBounds(i);
+                        commands.DrawModel(mr.ModelAsset, transform, nullptr, worldBounds, mr.SelectedLOD, gpuCulling);
                     }
                 }
-                
+
                 // Draw primitive cubes for entities without models (for debugging)
                 else {
-                    Renderer3D::DrawCube(transform.GetTransform(), glm::vec4(1.0f, 0.5f, 0.2f, 1.0f));
+                    commands.DrawCube(transform, glm::vec4(1.0f, 0.5f, 0.2f, 1.0f));
                 }
             }
-        }
+        });
+    }
+
+    void ViewportPanel::DrawSnapshot(RenderSnapshot& snapshot) {
+        // Bind framebuffer
+        m_Framebuffer->Bind();
+
+        // Clear
+        RenderCommand::SetClearColor({ 0.2f, 0.3f, 0.4f, 1.0f });
+        RenderCommand::Clear();
+
+        // Begin 3D rendering
+        Renderer3D::BeginScene(snapshot.View);
+
+        // Draw grid
+        Renderer3D::DrawGrid();
+
+        // Only this thread talks to GL, so the lists are replayed here. Occluders land in their
+        // own queue and are drawn by the pyramid build; the main pass waits for EndScene.
+        for (auto& commands : snapshot.CommandLists)
+            Renderer3D::SubmitCommandList(commands);
+        if (snapshot.Occlusion)
+            Renderer3D::BuildOcclusionPyramid(m_Framebuffer);
 
         // End 3D rendering
         Renderer3D::EndScene();
@@ -127,6 +238,17 @@ namespace ClaudeEngine {
         
         ImGui::Image((void*)(intptr_t)textureID, ImVec2(m_ViewportSize.x, m_ViewportSize.y), ImVec2(0, 1), ImVec2(1, 0));
 
+        // Left clicks pick the entity under the cursor, or clear the selection; gizmo handles win
+        m_EntityPicked = false;
+        if (m_Scene && ImGui::IsItemClicked(ImGuiMouseButton_Left) && !ImGuizmo::IsOver()) {
+            ImVec2 mouse = ImGui::GetMousePos();
+            Ray ray = m_EditorCamera.ScreenPointToRay(mouse.x - m_ViewportBounds[0].x, mouse.y - m_ViewportBounds[0].y);
+            // Nothing past the far clip plane is drawn, so nothing past it can be clicked
+            entt::entity picked = m_Scene->Pick(ray, m_EditorCamera.GetFarClip());
+            m_SelectedEntity = picked == entt::null ? Entity() : Entity{ picked, m_Scene.get() };
+            m_EntityPicked = true;
+        }
+
         // Render gizmos
         RenderGizmos();
 
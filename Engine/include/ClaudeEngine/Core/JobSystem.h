@@ -0,0 +1,28 @@
+#pragma once
+
+#include "ClaudeEngine/Core/Core.h"
+#include <cstdint>
+#include <functional>
+
+namespace ClaudeEngine {
+
+    // Fixed pool of worker threads for data-parallel CPU work. Jobs must not touch the GL context;
+    // they hand results back to the calling thread, which works alongside the pool.
+    class JobSystem {
+    public:
+        // threadCount includes the calling thread; 0 uses every hardware thread
+        static void Init(uint32_t threadCount = 0);
+        static void Shutdown();
+
+        // Thread indices passed to jobs are below this; the calling thread is 0
+        static uint32_t GetThreadCount();
+
+        using RangeJob = std::function<void(uint32_t begin, uint32_t end, uint32_t thread)>;
+
+        // Splits [0, count) into ranges of at most grainSize and runs them across the pool, returning
+        // once all are done. A single range runs inline. Calls from different threads run one after
+        // another, with the caller as thread 0. Not reentrant: do not call from inside a job.
+        static void ParallelFor(uint32_t count, uint32_t grainSize, const RangeJob& job);
+    };
+
+}
@@ -6,36 +6,53 @@ namespace ClaudeEngine {
 
     class OpenGLVertexBuffer : public VertexBuffer {
     public:
-        OpenGLVertexBuffer(uint32_t size);
-        OpenGLVertexBuffer(float* vertices, uint32_t size);
+        OpenGLVertexBuffer(uint32_t size, BufferUsage usage);
+        OpenGLVertexBuffer(float* vertices, uint32_t size, BufferUsage usage);
         virtual ~OpenGLVertexBuffer();
 
         virtual void Bind() const override;
         virtual void Unbind() const override;
 
-        virtual void SetData(const void* data, uint32_t size) override;
+        virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+        virtual void GetData(void* data, uint32_t size, uint32_t offset = 0) const override;
 
         virtual const BufferLayout& GetLayout() const override { return m_Layout; }
         virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
 
+        virtual BufferUsage GetUsage() const override { return m_Usage; }
+        virtual uint32_t GetSize() const override { return m_Size; }
+        virtual uint32_t GetRendererID() const override { return m_RendererID; }
+
     private:
         uint32_t m_RendererID;
+        uint32_t m_Size;
+        BufferUsage m_Usage;
+        uint8_t* m_MappedData = nullptr;  // Stream and Readback buffers stay mapped
         BufferLayout m_Layout;
     };
 
     class OpenGLIndexBuffer : public IndexBuffer {
     public:
-        OpenGLIndexBuffer(uint32_t* indices, uint32_t count);
+        OpenGLIndexBuffer(uint32_t count, IndexType type, BufferUsage usage);
+        OpenGLIndexBuffer(uint32_t* indices, uint32_t count, BufferUsage usage);
         virtual ~OpenGLIndexBuffer();
 
         virtual void Bind() const override;
         virtual void Unbind() const override;
 
         virtual uint32_t GetCount() const override { return m_Count; }
+        virtual IndexType GetIndexType() const override { return m_Type; }
+        virtual BufferUsage GetUsage() const override { return m_Usage; }
+        virtual uint32_t GetRendererID() const override { return m_RendererID; }
+
+        virtual void SetData(const uint32_t* indices, uint32_t count, uint32_t offset = 0) override;
 
     private:
         uint32_t m_RendererID;
         uint32_t m_Count;
+        IndexType m_Type = IndexType::UInt32;
+        BufferUsage m_Usage;
+        uint8_t* m_MappedData = nullptr;
     };
 
 }
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "ClaudeEngine/Renderer/DepthPyramid.h"
+#include "ClaudeEngine/Renderer/Shader.h"
+#include <array>
+
+typedef struct __GLsync* GLsync;
+
+namespace ClaudeEngine {
+
+    class OpenGLDepthPyramid : public DepthPyramid {
+    public:
+        OpenGLDepthPyramid();
+        virtual ~OpenGLDepthPyramid();
+
+        virtual bool Build(const Ref<Framebuffer>& framebuffer, const glm::mat4& viewProjection) override;
+        virtual bool PollReadback(Readback& readback) override;
+
+        virtual void Bind(uint32_t slot) const override;
+
+        virtual uint32_t GetWidth() const override { return m_Width; }
+        virtual uint32_t GetHeight() const override { return m_Height; }
+        virtual uint32_t GetMipCount() const override { return m_MipCount; }
+
+    private:
+        void Resize(uint32_t sourceWidth, uint32_t sourceHeight);
+        void QueueReadback(const glm::mat4& viewProjection);
+        void ReleaseReadbacks();
+
+    private:
+        // Coarsest level that fits is copied back; 256x256 floats is 256 KB per copy
+        static constexpr uint32_t MaxReadbackSize = 256;
+        static constexpr uint32_t ReadbackSlots = 3;
+
+        struct ReadbackSlot {
+            GLsync Fence = nullptr;
+            uint64_t Sequence = 0;
+            glm::mat4 ViewProjection = glm::mat4(1.0f);
+        };
+
+        Ref<Shader> m_BuildShader;
+        UniformHandle m_SourceLevelHandle = 0;
+
+        uint32_t m_RendererID = 0;
+        uint32_t m_SourceWidth = 0, m_SourceHeight = 0;
+        uint32_t m_Width = 0, m_Height = 0;
+        uint32_t m_MipCount = 0;
+
+        // Persistently mapped pack buffer, one level-sized region per slot
+        uint32_t m_ReadbackBuffer = 0;
+        const float* m_ReadbackMapped = nullptr;
+        uint32_t m_ReadbackLevel = 0;
+        uint32_t m_ReadbackWidth = 0, m_ReadbackHeight = 0;
+        std::array<ReadbackSlot, ReadbackSlots> m_Slots;
+        uint32_t m_NextSlot = 0;
+        uint64_t m_NextSequence = 1;
+        uint64_t m_LastPolled = 0;
+    };
+
+}
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "ClaudeEngine/Renderer/Framebuffer.h"
+#include <deque>
+
+typedef struct __GLsync* GLsync;
 
 namespace ClaudeEngine {
 
@@ -16,6 +19,10 @@ namespace ClaudeEngine {
 
         virtual void Resize(uint32_t width, uint32_t height) override;
         virtual int ReadPixel(uint32_t attachmentIndex, int x, int y) override;
+        virtual void ReadPixelsAsync(uint32_t attachmentIndex, int x, int y, uint32_t width, uint32_t height,
+                                     PixelReadbackCallback callback) override;
+        virtual void PollReadbacks() override;
+        virtual uint32_t GetPendingReadbacks() const override { return (uint32_t)m_PendingReadbacks.size(); }
 
         virtual void ClearAttachment(uint32_t attachmentIndex, int value) override;
 
@@ -23,9 +30,26 @@ namespace ClaudeEngine {
             CE_CORE_ASSERT(index < m_ColorAttachments.size(), "Index out of bounds");
             return m_ColorAttachments[index];
         }
+        virtual uint32_t GetDepthAttachmentRendererID() const override { return m_DepthAttachment; }
 
         virtual const FramebufferSpecification& GetSpecification() const override { return m_Specification; }
 
+    private:
+        void Release();
+
+        struct ReadbackBuffer {
+            uint32_t RendererID = 0;
+            uint32_t Capacity = 0; // Bytes
+        };
+        ReadbackBuffer AcquireReadbackBuffer(uint32_t size);
+
+        struct PendingReadback {
+            ReadbackBuffer Buffer;
+            GLsync Fence = nullptr;
+            PixelReadback Region;
+            PixelReadbackCallback Callback;
+        };
+
     private:
         uint32_t m_RendererID = 0;
         FramebufferSpecification m_Specification;
@@ -35,6 +59,10 @@ namespace ClaudeEngine {
 
         std::vector<uint32_t> m_ColorAttachments;
         uint32_t m_DepthAttachment = 0;
+
+        // Pack buffers outlive resizes; they only hold copies
+        std::deque<PendingReadback> m_PendingReadbacks;
+        std::vector<ReadbackBuffer> m_FreeReadbackBuffers;
     };
 
 }
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+typedef unsigned int GLenum;
+
+namespace ClaudeEngine {
+
+    // Linked program binaries persisted between runs. Entries are named by a hash of the stage
+    // sources and stamped with the driver they came from; anything that does not match, or that
+    // the driver refuses, is a miss and the caller compiles from source.
+    class OpenGLProgramCache {
+    public:
+        struct Statistics {
+            uint32_t Hits = 0;
+            uint32_t Misses = 0;
+            uint32_t Rejected = 0; // Present but stale, corrupt or refused by the driver
+            float LoadMs = 0.0f;   // Spent creating programs from binaries
+        };
+
+        // Relative to the working directory, like the asset paths
+        static void SetDirectory(const std::string& directory);
+        static void SetEnabled(bool enabled);
+
+        static uint64_t ComputeKey(const std::unordered_map<GLenum, std::string>& shaderSources);
+
+        // A linked program, or 0 on a miss
+        static uint32_t Load(uint64_t key);
+        // program must have been linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set
+        static void Store(uint64_t key, uint32_t program);
+
+        static const Statistics& GetStats();
+    };
+
+}
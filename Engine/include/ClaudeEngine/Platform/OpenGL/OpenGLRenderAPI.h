@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ClaudeEngine/Renderer/RenderAPI.h"
+#include "ClaudeEngine/Platform/OpenGL/OpenGLStateCache.h"
 
 namespace ClaudeEngine {
 
@@ -11,7 +12,32 @@ namespace ClaudeEngine {
         virtual void SetClearColor(const glm::vec4& color) override;
         virtual void Clear() override;
 
-        virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+        virtual void SetBlend(bool enabled) override;
+        virtual void SetDepthTest(bool enabled) override;
+        virtual void SetDepthWrite(bool enabled) override;
+        virtual void SetColorWrite(bool enabled) override;
+        virtual void SetFaceCulling(bool enabled) override;
+
+        virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t firstIndex = 0, int32_t baseVertex = 0) override;
+        virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount, uint32_t baseInstance = 0) override;
+        virtual void DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t firstCommand, uint32_t drawCount) override;
+        virtual void DrawIndexedIndirectCount(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t firstCommand,
+                                              const Ref<StorageBuffer>& counts, uint32_t countOffset, uint32_t maxDrawCount) override;
+
+        virtual void DispatchCompute(uint32_t groupsX, uint32_t groupsY = 1, uint32_t groupsZ = 1) override;
+        virtual void InsertMemoryBarrier(uint32_t barriers) override;
+
+        virtual const Capabilities& GetCapabilities() const override { return m_Capabilities; }
+
+        virtual StateStatistics GetStateStatistics() const override;
+        virtual void ResetStateStatistics() override;
+        virtual void InvalidateStateCache() override;
+
+        // Shared by every GL object so Bind() calls are filtered too
+        static OpenGLStateCache& GetStateCache();
+
+    private:
+        Capabilities m_Capabilities;
     };
 
 }
@@ -2,6 +2,8 @@
 
 #include "ClaudeEngine/Renderer/Shader.h"
 #include <glm/glm.hpp>
+#include <chrono>
+#include <vector>
 
 typedef unsigned int GLenum;
 
@@ -9,7 +11,8 @@ namespace ClaudeEngine {
 
     class OpenGLShader : public Shader {
     public:
-        OpenGLShader(const std::string& filepath);
+        // async leaves the compile running; it is finished by the first GetStatus that finds it done
+        OpenGLShader(const std::string& filepath, bool async = false);
         OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
         virtual ~OpenGLShader();
 
@@ -24,7 +27,28 @@ namespace ClaudeEngine {
         virtual void SetFloat4(const std::string& name, const glm::vec4& value) override;
         virtual void SetMat4(const std::string& name, const glm::mat4& value) override;
 
+        virtual void SetInt(UniformHandle handle, int value) override;
+        virtual void SetFloat(UniformHandle handle, float value) override;
+        virtual void SetFloat2(UniformHandle handle, const glm::vec2& value) override;
+        virtual void SetFloat3(UniformHandle handle, const glm::vec3& value) override;
+        virtual void SetFloat4(UniformHandle handle, const glm::vec4& value) override;
+        virtual void SetMat4(UniformHandle handle, const glm::mat4& value) override;
+
+        virtual bool HasUniform(UniformHandle handle) override { return GetUniformLocation(handle) != -1; }
+
         virtual const std::string& GetName() const override { return m_Name; }
+        virtual ShaderStatus GetStatus() override;
+
+        virtual const std::vector<std::string>& GetFeatures() const override { return m_Features; }
+        virtual Shader* GetVariant(ShaderFeatureMask features) override;
+
+        // Locations come from the table built at link time; unknown names fall back to GL once and are cached
+        int GetUniformLocation(const std::string& name);
+        int GetUniformLocation(UniformHandle handle) {
+            if (handle < m_HandleLocations.size() && m_HandleLocations[handle] != UnresolvedLocation)
+                return m_HandleLocations[handle];
+            return ResolveHandle(handle);
+        }
 
         void UploadUniformInt(const std::string& name, int value);
         void UploadUniformIntArray(const std::string& name, int* values, uint32_t count);
@@ -38,13 +62,36 @@ namespace ClaudeEngine {
         void UploadUniformMat4(const std::string& name, const glm::mat4& matrix);
 
     private:
+        // A permutation of a file shader, built from its already split stage sources
+        OpenGLShader(const std::string& name, const std::unordered_map<GLenum, std::string>& shaderSources);
+
         std::string ReadFile(const std::string& filepath);
         std::unordered_map<GLenum, std::string> PreProcess(const std::string& source);
-        void Compile(const std::unordered_map<GLenum, std::string>& shaderSources);
+        std::vector<std::string> ParseFeatures(const std::string& source);
+        // Starts compiling and linking without reading back any status; a program cache hit is Ready at once
+        void BeginCompile(const std::unordered_map<GLenum, std::string>& shaderSources);
+        // Reads back the results, blocking if the driver is not done yet
+        void FinishCompile();
+        void ReflectUniforms();
+        int ResolveHandle(UniformHandle handle);
 
     private:
-        uint32_t m_RendererID;
+        static constexpr int UnresolvedLocation = -2;
+
+        uint32_t m_RendererID = 0;
         std::string m_Name;
+        ShaderStatus m_Status = ShaderStatus::Compiling;
+        std::vector<uint32_t> m_PendingShaders; // Stage objects until FinishCompile
+        uint64_t m_CacheKey = 0;
+        std::chrono::high_resolution_clock::time_point m_CompileStart; // For the build time log
+
+        // Declared keywords, and the unspecialized stage sources variants are built from
+        std::vector<std::string> m_Features;
+        std::unordered_map<GLenum, std::string> m_VariantSources;
+        std::unordered_map<ShaderFeatureMask, Scope<OpenGLShader>> m_Variants;
+
+        std::unordered_map<std::string, int> m_UniformLocations;
+        std::vector<int> m_HandleLocations; // Indexed by UniformHandle
     };
 
 }
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ClaudeEngine {
+
+    // Shadow copy of the GL binding and fixed-function state. Calls that would not
+    // change anything are dropped before they reach the driver.
+    class OpenGLStateCache {
+    public:
+        static constexpr uint32_t MaxTextureUnits = 32;
+        static constexpr uint32_t MaxIndexedBindings = 16;
+
+        struct Counters {
+            uint32_t Issued = 0;
+            uint32_t Filtered = 0;
+        };
+
+        OpenGLStateCache() { Invalidate(); }
+
+        // Forget everything; the next call of each kind always reaches the driver
+        void Invalidate();
+        void InvalidateTextureUnits();
+
+        void UseProgram(uint32_t program);
+        void BindVertexArray(uint32_t vertexArray);
+        // Element array bindings are VAO state and always pass through
+        void BindBuffer(uint32_t target, uint32_t buffer);
+        // A size of 0 binds the whole buffer (glBindBufferBase)
+        void BindBufferRange(uint32_t target, uint32_t index, uint32_t buffer, ptrdiff_t offset = 0, ptrdiff_t size = 0);
+        void BindTextureUnit(uint32_t unit, uint32_t texture);
+        void BindImageTexture(uint32_t unit, uint32_t texture, uint32_t level, uint32_t access, uint32_t format);
+        void BindFramebuffer(uint32_t framebuffer);
+
+        void SetEnabled(uint32_t capability, bool enabled);
+        void SetBlendFunc(uint32_t source, uint32_t destination);
+        void SetDepthMask(bool write);
+        void SetDepthFunc(uint32_t function);
+        void SetColorMask(bool write);
+        void SetViewport(int32_t x, int32_t y, int32_t width, int32_t height);
+        void SetClearColor(const glm::vec4& color);
+
+        // Deleting a bound object resets its binding to 0 in GL; mirror that
+        void OnProgramDeleted(uint32_t program);
+        void OnVertexArrayDeleted(uint32_t vertexArray);
+        void OnBufferDeleted(uint32_t buffer);
+        void OnTextureDeleted(uint32_t texture);
+        void OnFramebufferDeleted(uint32_t framebuffer);
+
+        const Counters& GetCounters() const { return m_Counters; }
+        void ResetCounters() { m_Counters = Counters(); }
+
+    private:
+        // Returns true when the call should be issued, and counts it either way
+        bool Changed(bool changed);
+
+    private:
+        static constexpr uint32_t Unknown = 0xFFFFFFFF;
+
+        enum CapabilityIndex : uint32_t {
+            BlendCapability = 0, DepthTestCapability, CullFaceCapability, LineSmoothCapability, CapabilityCount
+        };
+        // -1 = unknown, 0 = disabled, 1 = enabled
+        std::array<int8_t, CapabilityCount> m_Capabilities;
+
+        struct IndexedBinding {
+            uint32_t Buffer = Unknown;
+            ptrdiff_t Offset = 0;
+            ptrdiff_t Size = 0;
+        };
+
+        uint32_t m_Program = Unknown;
+        uint32_t m_VertexArray = Unknown;
+        uint32_t m_ArrayBuffer = Unknown;
+        uint32_t m_DrawIndirectBuffer = Unknown;
+        uint32_t m_ParameterBuffer = Unknown;
+        uint32_t m_PixelPackBuffer = Unknown;
+        uint32_t m_Framebuffer = Unknown;
+        std::array<uint32_t, MaxTextureUnits> m_TextureUnits;
+        std::array<IndexedBinding, MaxIndexedBindings> m_UniformBindings;
+        std::array<IndexedBinding, MaxIndexedBindings> m_StorageBindings;
+
+        struct ImageBinding {
+            uint32_t Texture = Unknown;
+            uint32_t Level = 0;
+            uint32_t Access = 0;
+            uint32_t Format = 0;
+        };
+        std::array<ImageBinding, MaxIndexedBindings> m_ImageUnits;
+
+        uint32_t m_BlendSource = Unknown;
+        uint32_t m_BlendDestination = Unknown;
+        int8_t m_DepthMask = -1;
+        uint32_t m_DepthFunc = Unknown;
+        int8_t m_ColorMask = -1;
+        bool m_ViewportValid = false;
+        std::array<int32_t, 4> m_Viewport = {};
+        bool m_ClearColorValid = false;
+        glm::vec4 m_ClearColor = glm::vec4(0.0f);
+
+        Counters m_Counters;
+    };
+
+}
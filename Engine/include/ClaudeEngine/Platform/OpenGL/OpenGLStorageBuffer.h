@@ -0,0 +1,51 @@
+#pragma once
+
+#include "ClaudeEngine/Renderer/StorageBuffer.h"
+#include <vector>
+
+typedef struct __GLsync* GLsync;
+
+namespace ClaudeEngine {
+
+    class OpenGLStorageBuffer : public StorageBuffer {
+    public:
+        OpenGLStorageBuffer(uint32_t segmentSize, uint32_t segmentCount, uint32_t binding);
+        OpenGLStorageBuffer(uint32_t size, uint32_t binding);
+        virtual ~OpenGLStorageBuffer();
+
+        virtual void* Allocate(uint32_t size) override;
+
+        virtual uint32_t GetSegmentSize() const override { return m_SegmentSize; }
+        virtual uint32_t GetSegmentCount() const override { return m_SegmentCount; }
+        virtual uint32_t GetAllocationOffset() const override { return m_AllocationOffset; }
+
+        virtual uint32_t GetRendererID() const override { return m_RendererID; }
+
+        virtual void GetData(void* data, uint32_t size, uint32_t offset = 0) const override;
+
+        // Every live mapped buffer, see StorageBuffer::EndFrame
+        static void EndFrameAll();
+
+    private:
+        void WaitForSegment();
+        void FenceSegment();
+
+    private:
+        uint32_t m_RendererID = 0;
+        uint32_t m_Binding;
+        uint32_t m_SegmentSize;  // Rounded up to the storage buffer offset alignment
+        uint32_t m_SegmentCount;
+        uint32_t m_Alignment = 1;
+        uint32_t m_CurrentSegment = 0;
+
+        // Within the current segment; 0 until the frame's first allocation
+        uint32_t m_Cursor = 0;
+        bool m_SegmentOpen = false;
+        uint32_t m_AllocationOffset = 0;
+        bool m_WarnedFull = false;
+
+        uint8_t* m_MappedData = nullptr;
+        std::vector<GLsync> m_Fences;
+    };
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "ClaudeEngine/Renderer/StreamBuffer.h"
+#include <deque>
+
+typedef struct __GLsync* GLsync;
+
+namespace ClaudeEngine {
+
+    class OpenGLStreamBuffer : public StreamBuffer {
+    public:
+        OpenGLStreamBuffer(uint32_t size);
+        virtual ~OpenGLStreamBuffer();
+
+        virtual StreamAllocation Allocate(uint32_t size, Usage usage) override;
+        virtual void Bind(Usage usage, uint32_t binding, const StreamAllocation& allocation) override;
+        virtual void EndFrame() override;
+
+        virtual uint32_t GetRendererID() const override { return m_RendererID; }
+        virtual const Statistics& GetStats() const override { return m_Stats; }
+
+    private:
+        // Span of the ring written during one frame, released when its fence passes
+        struct FrameFence {
+            GLsync Fence;
+            uint32_t Bytes;
+        };
+
+        // Waits for the oldest frame and returns its space to the ring
+        void RetireOldestFrame();
+
+    private:
+        uint32_t m_RendererID = 0;
+        uint32_t m_Size;
+        uint8_t* m_MappedData = nullptr;
+        uint32_t m_UniformAlignment = 256;
+        uint32_t m_StorageAlignment = 16;
+
+        uint32_t m_Head = 0;        // Next free byte
+        uint32_t m_Used = 0;        // Bytes between the oldest unretired frame and the head
+        uint32_t m_FrameBytes = 0;  // Claimed since the last fence, wrap padding included
+        uint32_t m_FrameTotal = 0;  // Claimed since the last EndFrame
+        std::deque<FrameFence> m_Frames;
+
+        Statistics m_Stats;
+    };
+
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "ClaudeEngine/Renderer/UniformBuffer.h"
+
+namespace ClaudeEngine {
+
+    class OpenGLUniformBuffer : public UniformBuffer {
+    public:
+        OpenGLUniformBuffer(uint32_t size, uint32_t binding);
+        virtual ~OpenGLUniformBuffer();
+
+        virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+        virtual void Bind() const override;
+
+    private:
+        uint32_t m_RendererID = 0;
+        uint32_t m_Binding;
+        uint32_t m_Size;
+    };
+
+}
@@ -13,6 +13,7 @@ namespace ClaudeEngine {
         virtual void Unbind() const override;
 
         virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+        virtual void SetVertexBuffer(uint32_t slot, const Ref<VertexBuffer>& vertexBuffer) override;
         virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override;
 
         virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
@@ -20,7 +21,7 @@ namespace ClaudeEngine {
 
     private:
         uint32_t m_RendererID;
-        uint32_t m_VertexBufferIndex = 0;
+        uint32_t m_VertexBufferIndex = 0; // Next attribute location
         std::vector<Ref<VertexBuffer>> m_VertexBuffers;
         Ref<IndexBuffer> m_IndexBuffer;
     };
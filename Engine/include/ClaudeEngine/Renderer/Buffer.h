@@ -7,7 +7,9 @@
 namespace ClaudeEngine {
 
     enum class ShaderDataType {
-        None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool
+        None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool,
+        // Read as floats in the shader; shorts are usually normalized
+        Short2, Short4, Half2
     };
 
     static uint32_t ShaderDataTypeSize(ShaderDataType type) {
@@ -23,6 +25,9 @@ namespace ClaudeEngine {
             case ShaderDataType::Int3:     return 4 * 3;
             case ShaderDataType::Int4:     return 4 * 4;
             case ShaderDataType::Bool:     return 1;
+            case ShaderDataType::Short2:   return 2 * 2;
+            case ShaderDataType::Short4:   return 2 * 4;
+            case ShaderDataType::Half2:    return 2 * 2;
             default: return 0;
         }
     }
@@ -51,6 +56,9 @@ namespace ClaudeEngine {
                 case ShaderDataType::Int3:    return 3;
                 case ShaderDataType::Int4:    return 4;
                 case ShaderDataType::Bool:    return 1;
+                case ShaderDataType::Short2:  return 2;
+                case ShaderDataType::Short4:  return 4;
+                case ShaderDataType::Half2:   return 2;
                 default: return 0;
             }
         }
@@ -59,12 +67,14 @@ namespace ClaudeEngine {
     class BufferLayout {
     public:
         BufferLayout() {}
-        BufferLayout(const std::initializer_list<BufferElement>& elements)
-            : m_Elements(elements) {
+        BufferLayout(const std::initializer_list<BufferElement>& elements, bool instanced = false)
+            : m_Elements(elements), m_Instanced(instanced) {
             CalculateOffsetsAndStride();
         }
 
         inline uint32_t GetStride() const { return m_Stride; }
+        // Instanced layouts advance once per instance instead of once per vertex
+        inline bool IsInstanced() const { return m_Instanced; }
         inline const std::vector<BufferElement>& GetElements() const { return m_Elements; }
 
         std::vector<BufferElement>::iterator begin() { return m_Elements.begin(); }
@@ -86,6 +96,15 @@ namespace ClaudeEngine {
     private:
         std::vector<BufferElement> m_Elements;
         uint32_t m_Stride = 0;
+        bool m_Instanced = false;
+    };
+
+    // Buffers are allocated once with immutable storage; the usage decides how the CPU may touch it
+    enum class BufferUsage {
+        Static,   // Contents fixed at creation, no CPU access afterwards
+        Dynamic,  // Updated now and then through SetData
+        Stream,   // Rewritten every frame through a persistent mapping; the caller keeps the GPU off live ranges
+        Readback  // Written by the GPU and read back through GetData
     };
 
     class VertexBuffer {
@@ -95,15 +114,30 @@ namespace ClaudeEngine {
         virtual void Bind() const = 0;
         virtual void Unbind() const = 0;
 
-        virtual void SetData(const void* data, uint32_t size) = 0;
+        // Not allowed on Static buffers
+        virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+        // Readback buffers only; make sure the GPU writes have completed first
+        virtual void GetData(void* data, uint32_t size, uint32_t offset = 0) const = 0;
 
         virtual const BufferLayout& GetLayout() const = 0;
         virtual void SetLayout(const BufferLayout& layout) = 0;
 
-        static Ref<VertexBuffer> Create(uint32_t size);
-        static Ref<VertexBuffer> Create(float* vertices, uint32_t size);
+        virtual BufferUsage GetUsage() const = 0;
+        virtual uint32_t GetSize() const = 0;
+        virtual uint32_t GetRendererID() const = 0;
+
+        static Ref<VertexBuffer> Create(uint32_t size, BufferUsage usage = BufferUsage::Dynamic);
+        static Ref<VertexBuffer> Create(float* vertices, uint32_t size, BufferUsage usage = BufferUsage::Static);
+    };
+
+    enum class IndexType {
+        UInt16, UInt32
     };
 
+    inline uint32_t IndexTypeSize(IndexType type) {
+        return type == IndexType::UInt16 ? 2 : 4;
+    }
+
     class IndexBuffer {
     public:
         virtual ~IndexBuffer() = default;
@@ -112,8 +146,16 @@ namespace ClaudeEngine {
         virtual void Unbind() const = 0;
 
         virtual uint32_t GetCount() const = 0;
+        virtual IndexType GetIndexType() const = 0;
+        virtual BufferUsage GetUsage() const = 0;
+        virtual uint32_t GetRendererID() const = 0;
+
+        // offset and count are in indices. 16-bit buffers narrow the values, which must fit.
+        // Not allowed on Static buffers.
+        virtual void SetData(const uint32_t* indices, uint32_t count, uint32_t offset = 0) = 0;
 
-        static Ref<IndexBuffer> Create(uint32_t* indices, uint32_t count);
+        static Ref<IndexBuffer> Create(uint32_t count, IndexType type = IndexType::UInt32, BufferUsage usage = BufferUsage::Dynamic);
+        static Ref<IndexBuffer> Create(uint32_t* indices, uint32_t count, BufferUsage usage = BufferUsage::Static);
     };
 
 }
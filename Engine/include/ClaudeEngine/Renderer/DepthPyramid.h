@@ -0,0 +1,41 @@
+#pragma once
+
+#include "ClaudeEngine/Core/Core.h"
+#include "ClaudeEngine/Renderer/Framebuffer.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace ClaudeEngine {
+
+    // Hierarchical-Z buffer: a mip chain where each texel holds the farthest depth of the area it
+    // covers, so a few fetches tell whether anything behind a screen rect could be visible.
+    // Level 0 is the largest power of two that fits the source in each dimension.
+    class DepthPyramid {
+    public:
+        // CPU copy of one coarse level
+        struct Readback {
+            std::vector<float> Depth; // Row-major, bottom row first
+            uint32_t Width = 0;
+            uint32_t Height = 0;
+            glm::mat4 ViewProjection = glm::mat4(1.0f); // Camera the depth was rendered with
+        };
+
+        virtual ~DepthPyramid() = default;
+
+        // Reduces the framebuffer's depth attachment into the pyramid and queues an asynchronous
+        // copy of a coarse level for the CPU. False if nothing was built (e.g. multisampled depth).
+        virtual bool Build(const Ref<Framebuffer>& framebuffer, const glm::mat4& viewProjection) = 0;
+        // Takes the newest copy that finished since the last call; never waits on the GPU
+        virtual bool PollReadback(Readback& readback) = 0;
+
+        virtual void Bind(uint32_t slot) const = 0;
+
+        virtual uint32_t GetWidth() const = 0;
+        virtual uint32_t GetHeight() const = 0;
+        virtual uint32_t GetMipCount() const = 0;
+
+        static Ref<DepthPyramid> Create();
+    };
+
+}
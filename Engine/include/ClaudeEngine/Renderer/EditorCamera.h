@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ClaudeEngine/Core/Core.h"
+#include "ClaudeEngine/Renderer/Frustum.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 
@@ -27,6 +28,8 @@ namespace ClaudeEngine {
         const glm::mat4& GetViewMatrix() const { return m_ViewMatrix; }
         const glm::mat4& GetProjection() const { return m_Projection; }
         glm::mat4 GetViewProjection() const { return m_Projection * m_ViewMatrix; }
+        float GetNearClip() const { return m_NearClip; }
+        float GetFarClip() const { return m_FarClip; }
 
         glm::vec3 GetUpDirection() const;
         glm::vec3 GetRightDirection() const;
@@ -34,6 +37,9 @@ namespace ClaudeEngine {
         const glm::vec3& GetPosition() const { return m_Position; }
         glm::quat GetOrientation() const;
 
+        // World-space ray through a viewport pixel, measured from the top-left corner
+        Ray ScreenPointToRay(float x, float y) const;
+
         float GetPitch() const { return m_Pitch; }
         float GetYaw() const { return m_Yaw; }
 
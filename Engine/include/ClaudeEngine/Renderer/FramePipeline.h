@@ -0,0 +1,78 @@
+#pragma once
+
+#include "ClaudeEngine/Core/Core.h"
+#include "ClaudeEngine/Renderer/RenderCommandList.h"
+#include "ClaudeEngine/Renderer/RenderView.h"
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ClaudeEngine {
+
+    // Everything the GL thread needs to draw one frame, recorded without touching GL
+    struct RenderSnapshot {
+        RenderView View;
+        std::vector<RenderCommandList> CommandLists;
+        bool Occlusion = false; // Build the Hi-Z pyramid from the recorded occluders
+        uint64_t Frame = 0;     // Frame the snapshot was prepared in
+    };
+
+    // Two snapshots shared between a producer thread that prepares the next frame and the GL thread
+    // drawing the current one. In direct mode both happen back to back on the GL thread instead.
+    // The GL context never leaves the thread that calls Draw.
+    class FramePipeline {
+    public:
+        using PrepareFunction = std::function<void(RenderSnapshot& snapshot)>;
+        using DrawFunction = std::function<void(RenderSnapshot& snapshot)>;
+
+        struct Timings {
+            float PrepareMs = 0.0f;     // Recording the drawn snapshot, on whichever thread did it
+            float WaitMs = 0.0f;        // GL thread blocked on the producer
+            float SubmitMs = 0.0f;      // Drawing the snapshot on the GL thread
+            uint32_t LatencyFrames = 0; // Frames between preparing and drawing it
+        };
+
+        FramePipeline() = default;
+        ~FramePipeline();
+
+        // Pipelined mode overlaps preparing a frame with the rest of the previous one, at the cost
+        // of drawing one frame behind
+        void SetPipelined(bool pipelined) { m_Pipelined = pipelined; }
+        bool IsPipelined() const { return m_Pipelined; }
+
+        // Draws this frame's snapshot. Direct mode prepares it first; pipelined mode takes the one
+        // started by the last Launch, preparing inline when there is none.
+        void Draw(const PrepareFunction& prepare, const DrawFunction& draw);
+        // Pipelined mode only: starts preparing the next frame's snapshot on the producer thread.
+        // Whatever prepare reads must stay untouched until the next Wait or Draw.
+        void Launch(PrepareFunction prepare);
+        // Blocks until the producer is idle
+        void Wait();
+
+        const Timings& GetTimings() const { return m_Timings; }
+
+    private:
+        void ProducerLoop();
+
+    private:
+        std::thread m_Producer;
+        std::mutex m_Mutex;
+        std::condition_variable m_Condition;
+        PrepareFunction m_Task;
+        RenderSnapshot* m_TaskSnapshot = nullptr;
+        float m_TaskMs = 0.0f;
+        bool m_Busy = false;
+        bool m_Quit = false;
+
+        RenderSnapshot m_Snapshots[2];
+        uint32_t m_Front = 0;
+        bool m_Pending = false; // The back snapshot holds a launched frame not drawn yet
+        uint64_t m_Frame = 0;
+        bool m_Pipelined = false;
+        Timings m_Timings;
+    };
+
+}
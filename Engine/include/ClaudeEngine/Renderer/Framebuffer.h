@@ -2,6 +2,7 @@
 
 #include "ClaudeEngine/Core/Core.h"
 #include <cstdint>
+#include <functional>
 #include <vector>
 
 namespace ClaudeEngine {
@@ -45,6 +46,17 @@ namespace ClaudeEngine {
         bool SwapChainTarget = false;
     };
 
+    // Pixels of an integer attachment read back without stalling, see Framebuffer::ReadPixelsAsync
+    struct PixelReadback {
+        int X = 0, Y = 0;              // Lower-left corner after clamping to the framebuffer
+        uint32_t Width = 0, Height = 0;
+        std::vector<int> Values;       // Row-major, bottom row first
+
+        // Distinct values in the region, e.g. the entity IDs under a marquee, in first-seen order
+        std::vector<int> GetUniqueValues(int ignoreValue = -1) const;
+    };
+    using PixelReadbackCallback = std::function<void(const PixelReadback&)>;
+
     class Framebuffer {
     public:
         virtual ~Framebuffer() = default;
@@ -53,11 +65,26 @@ namespace ClaudeEngine {
         virtual void Unbind() = 0;
 
         virtual void Resize(uint32_t width, uint32_t height) = 0;
+        // Waits for the GPU to finish the frame; prefer ReadPixelAsync
         virtual int ReadPixel(uint32_t attachmentIndex, int x, int y) = 0;
 
+        // Copies a region of an integer attachment into a pixel buffer behind a fence and returns
+        // at once. The callback runs from PollReadbacks once the copy has landed, usually a frame
+        // or two later. Regions are clamped to the framebuffer; empty ones are dropped.
+        virtual void ReadPixelsAsync(uint32_t attachmentIndex, int x, int y, uint32_t width, uint32_t height,
+                                     PixelReadbackCallback callback) = 0;
+        void ReadPixelAsync(uint32_t attachmentIndex, int x, int y, std::function<void(int)> callback) {
+            ReadPixelsAsync(attachmentIndex, x, y, 1, 1, [callback](const PixelReadback& readback) { callback(readback.Values[0]); });
+        }
+        // Call once per frame. Runs the callbacks of finished reads in request order; never waits.
+        virtual void PollReadbacks() = 0;
+        virtual uint32_t GetPendingReadbacks() const = 0;
+
         virtual void ClearAttachment(uint32_t attachmentIndex, int value) = 0;
 
         virtual uint32_t GetColorAttachmentRendererID(uint32_t index = 0) const = 0;
+        // 0 when the framebuffer has no depth attachment
+        virtual uint32_t GetDepthAttachmentRendererID() const = 0;
 
         virtual const FramebufferSpecification& GetSpecification() const = 0;
 
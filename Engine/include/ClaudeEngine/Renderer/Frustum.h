@@ -0,0 +1,80 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cfloat>
+
+namespace ClaudeEngine {
+
+    struct Ray {
+        glm::vec3 Origin = glm::vec3(0.0f);
+        glm::vec3 Direction = glm::vec3(0.0f, 0.0f, -1.0f);
+
+        Ray() = default;
+        Ray(const glm::vec3& origin, const glm::vec3& direction) : Origin(origin), Direction(direction) {}
+    };
+
+    struct AABB {
+        glm::vec3 Min = glm::vec3(FLT_MAX);
+        glm::vec3 Max = glm::vec3(-FLT_MAX);
+
+        AABB() = default;
+        AABB(const glm::vec3& min, const glm::vec3& max) : Min(min), Max(max) {}
+
+        bool IsValid() const { return Min.x <= Max.x && Min.y <= Max.y && Min.z <= Max.z; }
+
+        glm::vec3 GetCenter() const { return (Min + Max) * 0.5f; }
+        glm::vec3 GetExtents() const { return (Max - Min) * 0.5f; }
+
+        void Expand(const glm::vec3& point);
+        void Expand(const AABB& other);
+
+        bool Contains(const AABB& other) const {
+            return Min.x <= other.Min.x && Min.y <= other.Min.y && Min.z <= other.Min.z
+                && Max.x >= other.Max.x && Max.y >= other.Max.y && Max.z >= other.Max.z;
+        }
+        bool Overlaps(const AABB& other) const {
+            return Min.x <= other.Max.x && Max.x >= other.Min.x
+                && Min.y <= other.Max.y && Max.y >= other.Min.y
+                && Min.z <= other.Max.z && Max.z >= other.Min.z;
+        }
+
+        // Half the surface area, used as the BVH insertion cost
+        float GetHalfArea() const {
+            glm::vec3 d = Max - Min;
+            return d.x * d.y + d.y * d.z + d.z * d.x;
+        }
+
+        // Slab test; on hit, distance receives the entry point along the ray (0 if the origin is inside)
+        bool Intersects(const Ray& ray, float maxDistance, float& distance) const;
+
+        // Bounds of this box after an affine transform (still axis aligned)
+        AABB Transform(const glm::mat4& transform) const;
+    };
+
+    struct Plane {
+        glm::vec3 Normal = glm::vec3(0.0f, 1.0f, 0.0f);
+        float Distance = 0.0f;
+
+        float GetSignedDistance(const glm::vec3& point) const { return glm::dot(Normal, point) + Distance; }
+    };
+
+    class Frustum {
+    public:
+        enum Side { Left = 0, Right, Bottom, Top, Near, Far, Count };
+
+        Frustum() = default;
+        Frustum(const glm::mat4& viewProjection) { Update(viewProjection); }
+
+        // Extracts the six clip planes from a view-projection matrix (normals point inward)
+        void Update(const glm::mat4& viewProjection);
+
+        bool Intersects(const AABB& box) const;
+        bool Intersects(const glm::vec3& center, float radius) const;
+
+        const Plane& GetPlane(Side side) const { return m_Planes[side]; }
+
+    private:
+        Plane m_Planes[Count];
+    };
+
+}
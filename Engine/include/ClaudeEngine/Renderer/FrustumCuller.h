@@ -0,0 +1,33 @@
+#pragma once
+
+#include "ClaudeEngine/Renderer/Frustum.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ClaudeEngine {
+
+    // World-space bounds stored as center/extents streams so the culler can test several boxes per instruction
+    struct BoundsSoA {
+        std::vector<float> CenterX, CenterY, CenterZ;
+        std::vector<float> ExtentX, ExtentY, ExtentZ;
+
+        void Clear();
+        void Reserve(size_t count);
+        void Push(const AABB& box);
+
+        size_t Size() const { return CenterX.size(); }
+    };
+
+    class FrustumCuller {
+    public:
+        // Writes 1 (visible) or 0 (culled) per box into visibility and returns the visible count.
+        // Dispatches to the widest kernel the build targets: AVX2 (8 boxes), SSE (4 boxes) or scalar
+        static size_t Cull(const Frustum& frustum, const BoundsSoA& bounds, uint8_t* visibility);
+
+        static size_t CullScalar(const Frustum& frustum, const BoundsSoA& bounds, uint8_t* visibility);
+
+        static const char* GetKernelName();
+    };
+
+}
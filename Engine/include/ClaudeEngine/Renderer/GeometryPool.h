@@ -0,0 +1,64 @@
+#pragma once
+
+#include "ClaudeEngine/Core/Core.h"
+#include "ClaudeEngine/Renderer/VertexArray.h"
+#include "ClaudeEngine/Renderer/VertexFormat.h"
+#include <cstdint>
+
+namespace ClaudeEngine {
+
+    struct Vertex;
+
+    // Where a mesh lives inside the pool. Indices stay mesh-local; BaseVertex rebases them.
+    struct GeometryAllocation {
+        static constexpr uint32_t InvalidPage = 0xFFFFFFFF;
+
+        uint32_t Page = InvalidPage;
+        uint32_t BaseVertex = 0;
+        uint32_t VertexCount = 0;
+        uint32_t FirstIndex = 0;
+        uint32_t IndexCount = 0;
+
+        bool IsValid() const { return Page != InvalidPage; }
+    };
+
+    // Sub-allocates static mesh geometry into a few large vertex/index buffers. Every mesh in
+    // a page shares the page's vertex array, so draws of different meshes differ only by
+    // offsets and can be merged into one multi-draw call. Pages hold a single vertex format and
+    // index type; meshes that fit use 16-bit indices.
+    class GeometryPool {
+    public:
+        static constexpr uint32_t PageVertexCapacity = 1 << 18;
+        static constexpr uint32_t PageIndexCapacity = 1 << 20;
+        // Largest vertex count whose mesh-local indices fit in 16 bits
+        static constexpr uint32_t MaxShortIndexVertices = 1 << 16;
+
+        static void Init();
+        static void Shutdown();
+
+        // Meshes larger than a page get a dedicated page sized to fit. vertices are already encoded
+        // in format, see PackVertices.
+        static GeometryAllocation Allocate(VertexFormat format, const void* vertices, uint32_t vertexCount,
+                                           const uint32_t* indices, uint32_t indexCount);
+        static GeometryAllocation Allocate(const Vertex* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount) {
+            return Allocate(VertexFormat::Standard, vertices, vertexCount, indices, indexCount);
+        }
+        // Pages left empty are released
+        static void Free(const GeometryAllocation& allocation);
+
+        static const Ref<VertexArray>& GetVertexArray(uint32_t page);
+
+        struct Statistics {
+            uint32_t Pages = 0;
+            uint32_t Allocations = 0;
+            uint32_t UsedVertices = 0;
+            uint32_t VertexCapacity = 0;
+            uint64_t UsedVertexBytes = 0;   // Varies with the vertex format of each mesh
+            uint32_t UsedIndices = 0;
+            uint32_t IndexCapacity = 0;
+            uint64_t UsedIndexBytes = 0;
+        };
+        static Statistics GetStats();
+    };
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "ClaudeEngine/Renderer/Frustum.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+
+namespace ClaudeEngine {
+
+    // Picks a level of detail from how much of the screen an object covers. Level n takes over
+    // below half the threshold of level n - 1, and objects have to move clearly past a threshold
+    // before switching so ones sitting near it do not pop back and forth every frame.
+    class LODSelector {
+    public:
+        // Fraction of the viewport height covered by the bounding sphere of worldBounds
+        static float ComputeScreenSize(const AABB& worldBounds, const glm::vec3& cameraPosition, const glm::mat4& projection);
+
+        // current is the level used last frame
+        static uint32_t Select(float screenSize, uint32_t current, uint32_t levelCount);
+
+        // Screen size below which level becomes eligible; level 1 starts under a quarter of the screen
+        static float GetThreshold(uint32_t level) { return FirstThreshold / (float)(1u << (level - 1)); }
+
+    private:
+        static constexpr float FirstThreshold = 0.25f;
+        static constexpr float Hysteresis = 0.1f;
+    };
+
+}
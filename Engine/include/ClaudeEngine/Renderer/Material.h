@@ -3,9 +3,11 @@
 #include "ClaudeEngine/Core/Core.h"
 #include "Shader.h"
 #include "Texture.h"
+#include "UniformBuffer.h"
 #include <glm/glm.hpp>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace ClaudeEngine {
 
@@ -59,20 +61,59 @@ namespace ClaudeEngine {
         float SubsurfaceRadius = 1.0f;
     };
 
+    // std140 layout of the MaterialParameters block (binding 2) in the bundled shaders
+    struct MaterialParameters {
+        glm::vec3 Albedo;
+        float Metallic;
+        glm::vec3 Emission;
+        float EmissionStrength;
+        float Roughness;
+        float AO;
+        float IOR;
+        float Transmission;
+        float NormalStrength;
+        int32_t UseAlbedoMap;
+        int32_t UseNormalMap;
+        int32_t UseMetallicRoughnessMap;
+        int32_t UseAOMap;
+        int32_t UseEmissionMap;
+        int32_t Padding[2];
+    };
+    static_assert(sizeof(MaterialParameters) == 80, "MaterialParameters must match the std140 block");
+
+    // Fixed texture units for the RayTracingProperties maps; generic textures follow
+    enum MaterialTextureSlot : uint32_t {
+        AlbedoSlot = 0,
+        NormalSlot,
+        MetallicRoughnessSlot,
+        AOSlot,
+        EmissionSlot,
+        FirstGenericSlot
+    };
+
     class Material {
     public:
         Material(const std::string& name = "Material", MaterialWorkflow workflow = MaterialWorkflow::PBR_MetallicRoughness);
         ~Material() = default;
 
-        void SetShader(const Ref<Shader>& shader) { m_Shader = shader; }
+        void SetShader(const Ref<Shader>& shader) { m_Shader = shader; m_VariantDirty = true; }
         Ref<Shader> GetShader() const { return m_Shader; }
 
+        // Feature keywords picking the shader variant. The maps present in the RT properties enable
+        // ALBEDO_MAP, NORMAL_MAP, METALLIC_ROUGHNESS_MAP, AO_MAP and EMISSION_MAP on their own
+        void SetKeyword(const std::string& keyword, bool enabled);
+        bool IsKeywordEnabled(const std::string& keyword) const;
+        // The shader permutation matching the keywords, which is what Bind binds. GL thread only:
+        // a new combination starts compiling here
+        Shader* GetVariant();
+
         void SetWorkflow(MaterialWorkflow workflow) { m_Workflow = workflow; }
         MaterialWorkflow GetWorkflow() const { return m_Workflow; }
 
-        // Ray tracing properties
-        RayTracingProperties& GetRTProperties() { return m_RTProperties; }
+        // Ray tracing properties. Changes go through SetRTProperties, which marks the parameter
+        // block for re-upload; reading never does
         const RayTracingProperties& GetRTProperties() const { return m_RTProperties; }
+        void SetRTProperties(const RayTracingProperties& properties) { m_RTProperties = properties; m_ParametersDirty = m_VariantDirty = true; }
 
         // Generic property setters
         void SetFloat(const std::string& name, float value);
@@ -80,24 +121,48 @@ namespace ClaudeEngine {
         void SetVec4(const std::string& name, const glm::vec4& value);
         void SetTexture(const std::string& name, const Ref<Texture2D>& texture);
 
-        // Bind material to shader
+        // Bind shader, parameter block and textures. The block is only uploaded when dirty
         void Bind();
         void Unbind();
 
+        bool IsDirty() const { return m_ParametersDirty; }
+
         const std::string& GetName() const { return m_Name; }
         void SetName(const std::string& name) { m_Name = name; }
 
+    private:
+        void UploadParameters();
+
+    private:
+        template<typename T>
+        struct Property {
+            UniformHandle Handle;
+            T Value;
+        };
+
+        template<typename T>
+        static void SetProperty(std::vector<Property<T>>& properties, const std::string& name, const T& value);
+
     private:
         std::string m_Name;
         Ref<Shader> m_Shader;
         MaterialWorkflow m_Workflow;
         RayTracingProperties m_RTProperties;
 
-        // Generic property storage
-        std::unordered_map<std::string, float> m_FloatProperties;
-        std::unordered_map<std::string, glm::vec3> m_Vec3Properties;
-        std::unordered_map<std::string, glm::vec4> m_Vec4Properties;
-        std::unordered_map<std::string, Ref<Texture2D>> m_TextureProperties;
+        std::vector<std::string> m_Keywords;
+        Shader* m_Variant = nullptr; // Owned by m_Shader
+        bool m_VariantDirty = true;
+
+        // Packed copy of m_RTProperties on the GPU
+        Ref<UniformBuffer> m_ParameterBuffer;
+        bool m_ParametersDirty = true;
+
+        // Generic properties are loose uniforms keyed by pre-resolved handles;
+        // generic textures take units from FirstGenericSlot upward, in insertion order
+        std::vector<Property<float>> m_FloatProperties;
+        std::vector<Property<glm::vec3>> m_Vec3Properties;
+        std::vector<Property<glm::vec4>> m_Vec4Properties;
+        std::vector<Property<Ref<Texture2D>>> m_TextureProperties;
     };
 
     // Material Library for managing materials
@@ -5,12 +5,16 @@
 #include "Buffer.h"
 #include "Shader.h"
 #include "Texture.h"
+#include "Frustum.h"
+#include "GeometryPool.h"
 #include <glm/glm.hpp>
 #include <vector>
 #include <string>
 
 namespace ClaudeEngine {
 
+    class TriangleBVH;
+
     struct Vertex {
         glm::vec3 Position;
         glm::vec3 Normal;
@@ -25,27 +29,99 @@ namespace ClaudeEngine {
         std::string Path;
     };
 
+    // Index range of one level of detail, relative to the mesh's first index
+    struct MeshLOD {
+        uint32_t FirstIndex = 0;
+        uint32_t IndexCount = 0;
+    };
+
+    // Cluster of LOD 0 triangles with its own culling bounds. Meshlets partition LOD 0 in order,
+    // so survivors next to each other merge into one index range.
+    struct Meshlet {
+        uint32_t FirstIndex = 0;   // Relative to the mesh's first index
+        uint32_t IndexCount = 0;
+        glm::vec3 Center = glm::vec3(0.0f);
+        float Radius = 0.0f;
+        // Normal cone: every triangle faces away from views inside it. A cutoff above 1 never culls.
+        glm::vec3 ConeApex = glm::vec3(0.0f);
+        float ConeCutoff = 2.0f;
+        glm::vec3 ConeAxis = glm::vec3(0.0f, 0.0f, 1.0f);
+
+        // viewPosition in the mesh's local space
+        bool IsBackFacing(const glm::vec3& viewPosition) const {
+            if (ConeCutoff > 1.0f)
+                return false;
+            glm::vec3 toApex = ConeApex - viewPosition;
+            float length = glm::length(toApex);
+            return length > 0.0f && glm::dot(toApex, ConeAxis) >= ConeCutoff * length;
+        }
+    };
+
     class Mesh {
     public:
+        // lodIndices holds coarser index lists over the same vertices, LOD 1 first. format only
+        // affects the GPU copy; the CPU-side vertices stay full precision. meshlets must partition
+        // indices, see MeshletBuilder.
         Mesh(const std::vector<Vertex>& vertices, 
              const std::vector<uint32_t>& indices,
-             const std::vector<MeshTexture>& textures);
+             const std::vector<MeshTexture>& textures,
+             const std::vector<std::vector<uint32_t>>& lodIndices = {},
+             VertexFormat format = VertexFormat::Standard,
+             const std::vector<Meshlet>& meshlets = {});
+        ~Mesh();
+
+        Mesh(const Mesh&) = delete;
+        Mesh& operator=(const Mesh&) = delete;
 
         void Draw(const Ref<Shader>& shader);
 
+        // Shared by every mesh in the same geometry pool page
         const Ref<VertexArray>& GetVertexArray() const { return m_VertexArray; }
+        uint32_t GetFirstIndex() const { return m_Geometry.FirstIndex; }
+        int32_t GetBaseVertex() const { return (int32_t)m_Geometry.BaseVertex; }
+
+        VertexFormat GetVertexFormat() const { return m_Format; }
+        bool HasQuantizedPositions() const { return m_Format == VertexFormat::PackedQuantized; }
+        // Maps quantized positions back to model space; apply before the model transform
+        const glm::mat4& GetDequantizeTransform() const { return m_DequantizeTransform; }
+
+        uint32_t GetVertexCount() const { return (uint32_t)m_Vertices.size(); }
+        uint32_t GetIndexCount() const { return (uint32_t)m_Indices.size(); }
+        const std::vector<Vertex>& GetVertices() const { return m_Vertices; }
+        const std::vector<uint32_t>& GetIndices() const { return m_Indices; }
+
+        // LOD 0 is the full mesh; levels past the last clamp to the coarsest
+        uint32_t GetLODCount() const { return (uint32_t)m_LODs.size(); }
+        const MeshLOD& GetLOD(uint32_t level) const { return m_LODs[level < m_LODs.size() ? level : m_LODs.size() - 1]; }
+
+        // Clusters of LOD 0; empty when the mesh was not split
+        bool HasMeshlets() const { return !m_Meshlets.empty(); }
+        const std::vector<Meshlet>& GetMeshlets() const { return m_Meshlets; }
+
+        // Local-space bounds of the vertex positions
+        const AABB& GetBoundingBox() const { return m_BoundingBox; }
+
+        // Triangle hierarchy over LOD 0 for ray casts, built on first use
+        const TriangleBVH& GetTriangleBVH() const;
 
     private:
-        void SetupMesh();
+        void SetupMesh(const std::vector<std::vector<uint32_t>>& lodIndices);
 
     private:
         std::vector<Vertex> m_Vertices;
         std::vector<uint32_t> m_Indices;
         std::vector<MeshTexture> m_Textures;
+        std::vector<MeshLOD> m_LODs;
+        std::vector<Meshlet> m_Meshlets;
+        AABB m_BoundingBox;
+
+        VertexFormat m_Format = VertexFormat::Standard;
+        glm::mat4 m_DequantizeTransform = glm::mat4(1.0f);
 
+        GeometryAllocation m_Geometry;
         Ref<VertexArray> m_VertexArray;
-        Ref<VertexBuffer> m_VertexBuffer;
-        Ref<IndexBuffer> m_IndexBuffer;
+
+        mutable Scope<TriangleBVH> m_TriangleBVH;
     };
 
 }
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "ClaudeEngine/Renderer/Mesh.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ClaudeEngine {
+
+    // Quadric error edge-collapse simplifier (Garland & Heckbert). Vertices collapse onto existing
+    // neighbours, so results index the source vertex buffer and every level of detail can share it.
+    // Open borders and attribute seams only collapse along themselves; everything else stays put.
+    class MeshSimplifier {
+    public:
+        // Collapses edges cheapest first until the index count reaches targetIndexCount or the next
+        // collapse would move the surface further than targetError, given as a fraction of the mesh
+        // extent. resultError receives the largest error introduced, in the same units.
+        static std::vector<uint32_t> Simplify(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                                              size_t targetIndexCount, float targetError, float* resultError = nullptr);
+
+        // Coarser index lists for LOD 1 and up, each aiming at half the triangles of the one before.
+        // Stops early when a level would barely save anything or the error budget runs out.
+        static std::vector<std::vector<uint32_t>> GenerateLODs(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                                                               uint32_t maxLevels = 3);
+    };
+
+}
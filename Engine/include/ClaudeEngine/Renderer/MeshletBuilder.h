@@ -0,0 +1,29 @@
+#pragma once
+
+#include "ClaudeEngine/Renderer/Mesh.h"
+#include <cstdint>
+#include <vector>
+
+namespace ClaudeEngine {
+
+    // Splits dense meshes into small clusters that can be culled individually, so a large model
+    // only submits the parts facing and inside the view.
+    class MeshletBuilder {
+    public:
+        static constexpr uint32_t MaxVertices = 64;
+        static constexpr uint32_t MaxTriangles = 124;
+        // Below this the per-cluster bookkeeping costs more than culling saves
+        static constexpr uint32_t MinTriangles = 4096;
+
+        // Grows clusters over shared vertices, favouring triangles that add no new vertices and
+        // bend the normal cone least. Reorders indices so every meshlet is a contiguous range.
+        // Without coneCulling every cone is left open.
+        static std::vector<Meshlet> Build(const std::vector<Vertex>& vertices, std::vector<uint32_t>& indices, bool coneCulling);
+
+        // True for closed, consistently outward-wound meshes. Only then are back faces always
+        // hidden by front faces, so dropping back-facing clusters cannot change the image while
+        // face culling is off.
+        static bool CanConeCull(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
+    };
+
+}
@@ -14,16 +14,37 @@ namespace ClaudeEngine {
         ~Model() = default;
 
         void Draw(const Ref<Shader>& shader);
-        void AddMesh(const Ref<Mesh>& mesh) { m_Meshes.push_back(mesh); }
+        void AddMesh(const Ref<Mesh>& mesh) {
+            m_Meshes.push_back(mesh);
+            m_BoundingBox.Expand(mesh->GetBoundingBox());
+            if (mesh->GetLODCount() > m_LODCount)
+                m_LODCount = mesh->GetLODCount();
+        }
 
         const std::vector<Ref<Mesh>>& GetMeshes() const { return m_Meshes; }
 
+        // GPU vertex format for meshes loaded from files from now on
+        static void SetImportVertexFormat(VertexFormat format);
+        static VertexFormat GetImportVertexFormat();
+        // Split dense meshes loaded from now on into meshlets for per-cluster culling
+        static void SetImportMeshlets(bool enabled);
+        static bool GetImportMeshlets();
+
+        // Union of all mesh bounds in model space
+        const AABB& GetBoundingBox() const { return m_BoundingBox; }
+        // Closest triangle hit of a model-space ray; distance is in units of the ray direction
+        bool Raycast(const Ray& ray, float maxDistance, float& distance) const;
+        // Most levels of any mesh; meshes with fewer clamp to their coarsest
+        uint32_t GetLODCount() const { return m_LODCount; }
+
     private:
         void LoadModel(const std::string& path);
 
     private:
         std::vector<Ref<Mesh>> m_Meshes;
         std::string m_Directory;
+        AABB m_BoundingBox;
+        uint32_t m_LODCount = 1;
     };
 
 }
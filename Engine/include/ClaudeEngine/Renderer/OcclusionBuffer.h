@@ -0,0 +1,36 @@
+#pragma once
+
+#include "ClaudeEngine/Renderer/DepthPyramid.h"
+#include "ClaudeEngine/Renderer/Frustum.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace ClaudeEngine {
+
+    // CPU-side Hi-Z built from a DepthPyramid readback. Bounds are projected with the camera the
+    // depth was rendered with, so an object that has just come out from behind an occluder may
+    // stay hidden until the next readback arrives.
+    class OcclusionBuffer {
+    public:
+        void Update(const DepthPyramid::Readback& readback);
+        void Clear() { m_Levels.clear(); }
+        bool IsValid() const { return !m_Levels.empty(); }
+
+        // True when the whole box lies behind the stored depth
+        bool IsOccluded(const AABB& worldBounds) const;
+
+    private:
+        struct Level {
+            uint32_t Width = 0;
+            uint32_t Height = 0;
+            std::vector<float> Depth;
+
+            float Fetch(uint32_t x, uint32_t y) const { return Depth[(size_t)y * Width + x]; }
+        };
+
+        std::vector<Level> m_Levels;
+        glm::mat4 m_ViewProjection = glm::mat4(1.0f);
+    };
+
+}
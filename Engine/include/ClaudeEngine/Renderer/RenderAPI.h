@@ -6,6 +6,16 @@
 namespace ClaudeEngine {
 
     class VertexArray;
+    class StorageBuffer;
+
+    // Same layout as GL's DrawElementsIndirectCommand
+    struct DrawIndexedIndirectCommand {
+        uint32_t IndexCount;
+        uint32_t InstanceCount;
+        uint32_t FirstIndex;
+        int32_t BaseVertex;
+        uint32_t BaseInstance;
+    };
 
     class RenderAPI {
     public:
@@ -15,6 +25,27 @@ namespace ClaudeEngine {
             Vulkan = 2  // For future implementation
         };
 
+        // Optional features; paths that need them fall back when they are missing
+        struct Capabilities {
+            bool ComputeShaders = false;
+            bool IndirectCount = false; // Draw count sourced from a GPU buffer
+        };
+
+        enum BarrierBits : uint32_t {
+            StorageBarrier = 1 << 0,         // Shader storage reads after compute writes
+            IndirectCommandBarrier = 1 << 1, // Indirect draw commands and counts written by compute
+            ReadbackBarrier = 1 << 2,        // Buffer reads from the CPU after compute writes
+            ClientMappedBarrier = 1 << 3,    // Persistently mapped reads from the CPU after compute writes
+            TextureFetchBarrier = 1 << 4,    // Texture sampling after image stores
+            TextureUpdateBarrier = 1 << 5    // Texture copies and readbacks after image stores
+        };
+
+        // Per-frame count of state changes sent to the driver vs. dropped as redundant
+        struct StateStatistics {
+            uint32_t IssuedCalls = 0;
+            uint32_t FilteredCalls = 0;
+        };
+
     public:
         virtual ~RenderAPI() = default;
 
@@ -23,7 +54,29 @@ namespace ClaudeEngine {
         virtual void SetClearColor(const glm::vec4& color) = 0;
         virtual void Clear() = 0;
 
-        virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) = 0;
+        virtual void SetBlend(bool enabled) = 0;
+        virtual void SetDepthTest(bool enabled) = 0;
+        virtual void SetDepthWrite(bool enabled) = 0;
+        virtual void SetColorWrite(bool enabled) = 0;
+        virtual void SetFaceCulling(bool enabled) = 0;
+
+        virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t firstIndex = 0, int32_t baseVertex = 0) = 0;
+        virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount, uint32_t baseInstance = 0) = 0;
+        // Issues drawCount DrawIndexedIndirectCommands starting at firstCommand in the latest allocation
+        virtual void DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t firstCommand, uint32_t drawCount) = 0;
+        // Same, but the draw count is a uint read from counts at countOffset bytes into its latest allocation
+        virtual void DrawIndexedIndirectCount(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t firstCommand,
+                                              const Ref<StorageBuffer>& counts, uint32_t countOffset, uint32_t maxDrawCount) = 0;
+
+        virtual void DispatchCompute(uint32_t groupsX, uint32_t groupsY = 1, uint32_t groupsZ = 1) = 0;
+        virtual void InsertMemoryBarrier(uint32_t barriers) = 0;
+
+        virtual const Capabilities& GetCapabilities() const = 0;
+
+        virtual StateStatistics GetStateStatistics() const = 0;
+        virtual void ResetStateStatistics() = 0;
+        // Call after third-party code may have touched GL state behind the cache
+        virtual void InvalidateStateCache() = 0;
 
         inline static API GetAPI() { return s_API; }
         static Scope<RenderAPI> Create();
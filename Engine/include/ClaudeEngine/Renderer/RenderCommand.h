@@ -22,8 +22,65 @@ namespace ClaudeEngine {
             s_RenderAPI->Clear();
         }
 
-        inline static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) {
-            s_RenderAPI->DrawIndexed(vertexArray, indexCount);
+        inline static void SetBlend(bool enabled) {
+            s_RenderAPI->SetBlend(enabled);
+        }
+
+        inline static void SetDepthTest(bool enabled) {
+            s_RenderAPI->SetDepthTest(enabled);
+        }
+
+        inline static void SetDepthWrite(bool enabled) {
+            s_RenderAPI->SetDepthWrite(enabled);
+        }
+
+        inline static void SetColorWrite(bool enabled) {
+            s_RenderAPI->SetColorWrite(enabled);
+        }
+
+        inline static void SetFaceCulling(bool enabled) {
+            s_RenderAPI->SetFaceCulling(enabled);
+        }
+
+        inline static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t firstIndex = 0, int32_t baseVertex = 0) {
+            s_RenderAPI->DrawIndexed(vertexArray, indexCount, firstIndex, baseVertex);
+        }
+
+        inline static void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount, uint32_t baseInstance = 0) {
+            s_RenderAPI->DrawIndexedInstanced(vertexArray, indexCount, instanceCount, baseInstance);
+        }
+
+        inline static void DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t firstCommand, uint32_t drawCount) {
+            s_RenderAPI->DrawIndexedIndirect(vertexArray, commands, firstCommand, drawCount);
+        }
+
+        inline static void DrawIndexedIndirectCount(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t firstCommand,
+                                                    const Ref<StorageBuffer>& counts, uint32_t countOffset, uint32_t maxDrawCount) {
+            s_RenderAPI->DrawIndexedIndirectCount(vertexArray, commands, firstCommand, counts, countOffset, maxDrawCount);
+        }
+
+        inline static void DispatchCompute(uint32_t groupsX, uint32_t groupsY = 1, uint32_t groupsZ = 1) {
+            s_RenderAPI->DispatchCompute(groupsX, groupsY, groupsZ);
+        }
+
+        inline static void InsertMemoryBarrier(uint32_t barriers) {
+            s_RenderAPI->InsertMemoryBarrier(barriers);
+        }
+
+        inline static const RenderAPI::Capabilities& GetCapabilities() {
+            return s_RenderAPI->GetCapabilities();
+        }
+
+        inline static RenderAPI::StateStatistics GetStateStatistics() {
+            return s_RenderAPI->GetStateStatistics();
+        }
+
+        inline static void ResetStateStatistics() {
+            s_RenderAPI->ResetStateStatistics();
+        }
+
+        inline static void InvalidateStateCache() {
+            s_RenderAPI->InvalidateStateCache();
         }
 
     private:
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "ClaudeEngine/Core/Core.h"
+#include "ClaudeEngine/Renderer/RenderQueue.h"
+#include "ClaudeEngine/Renderer/Renderer3D.h"
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace ClaudeEngine {
+
+    class Model;
+    class Material;
+
+    // Draws recorded away from the GL thread. Recording only reads the view given to Begin and
+    // renderer settings, so each thread can fill its own list in parallel, even a frame ahead of
+    // the GL thread, which replays them with Renderer3D::SubmitCommandList before EndScene.
+    class RenderCommandList {
+    public:
+        // Starts a new recording against view
+        void Begin(const RenderView& view);
+
+        // Same meaning as the Renderer3D calls of the same name, evaluated against the Begin view
+        void DrawModel(const Ref<Model>& model, const glm::mat4& transform, const Ref<Material>& material = nullptr,
+                       const AABB& worldBounds = AABB(), uint32_t lod = 0, bool cullOnGPU = false);
+        void DrawCube(const glm::mat4& transform, const glm::vec4& color = glm::vec4(1.0f));
+        uint32_t SelectLOD(const AABB& worldBounds, uint32_t currentLevel, uint32_t levelCount) const;
+        void CullBounds(const BoundsSoA& bounds, const uint8_t* cullable, std::vector<uint8_t>& visibility);
+        bool IsOccluderCandidate(const AABB& worldBounds) const;
+        void DrawOccluder(const Ref<Model>& model, const glm::mat4& transform, uint32_t lod = 0);
+        // Reads the renderer's current occlusion data, so only valid for the frame being drawn
+        bool IsOccluded(const AABB& worldBounds);
+
+        void Submit(DrawPacket&& packet) { m_Packets.push_back(std::move(packet)); }
+        void Clear();
+        size_t Size() const { return m_Packets.size(); }
+        bool Empty() const { return m_Packets.empty() && m_Occluders.empty(); }
+        const RenderView& GetView() const { return m_View; }
+
+    private:
+        friend class Renderer3D;
+
+        RenderView m_View;
+        std::vector<DrawPacket> m_Packets;
+        std::vector<DrawPacket> m_Occluders;
+        uint32_t m_OccluderCount = 0;
+        // Culling counters, added to the renderer's on submit
+        Renderer3D::Statistics m_Stats;
+    };
+
+}
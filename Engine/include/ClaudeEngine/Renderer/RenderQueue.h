@@ -0,0 +1,93 @@
+#pragma once
+
+#include "ClaudeEngine/Core/Core.h"
+#include "ClaudeEngine/Renderer/Frustum.h"
+#include "ClaudeEngine/Renderer/VertexFormat.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace ClaudeEngine {
+
+    class Shader;
+    class VertexArray;
+    class Material;
+
+    // Passes are flushed in enum order
+    enum class RenderPass : uint8_t {
+        Opaque = 0,
+        Transparent = 1,
+        Overlay = 2
+    };
+
+    // 64-bit sort key, most significant bits first:
+    //   Opaque/Overlay: [63-62] pass | [61-50] shader | [49-36] material | [35-20] mesh | [19-0] depth (front-to-back)
+    //   Transparent:    [63-62] pass | [61-42] depth (back-to-front) | [41-30] shader | [29-16] material | [15-0] mesh
+    struct RenderSortKey {
+        static constexpr uint32_t ShaderBits = 12;
+        static constexpr uint32_t MaterialBits = 14;
+        static constexpr uint32_t MeshBits = 16;
+        static constexpr uint32_t DepthBits = 20;
+
+        static uint64_t Encode(RenderPass pass, uint32_t shaderID, uint32_t materialID, uint32_t meshID, float depth);
+        static RenderPass DecodePass(uint64_t key) { return (RenderPass)(key >> 62); }
+    };
+
+    struct DrawPacket {
+        RenderPass Pass = RenderPass::Opaque;
+        Ref<Shader> ShaderProgram;
+        Ref<VertexArray> Geometry;
+        Ref<Material> MaterialInstance;
+
+        glm::mat4 Transform = glm::mat4(1.0f);
+        glm::vec4 Color = glm::vec4(1.0f);
+
+        uint32_t IndexCount = 0;
+        uint32_t VertexCount = 0;
+        // Sub-range of a pooled vertex array; zero for standalone geometry
+        uint32_t FirstIndex = 0;
+        int32_t BaseVertex = 0;
+        // Matches the vertex array's page; shaders decode packed attributes accordingly
+        VertexFormat Format = VertexFormat::Standard;
+        // World-space bounds; the GPU cull pass tests them when GPUCulled is set
+        AABB Bounds;
+        bool GPUCulled = false; // Needs valid Bounds
+        float Depth = 0.0f; // Normalized view depth [0, 1]
+    };
+
+    // Collects draw packets for a frame and orders them by sort key
+    class RenderQueue {
+    public:
+        struct Entry {
+            uint64_t Key;
+            uint32_t PacketIndex;
+        };
+
+        void Clear();
+        void Submit(DrawPacket&& packet);
+        void Sort();
+
+        const DrawPacket& GetPacket(const Entry& entry) const { return m_Packets[entry.PacketIndex]; }
+        const std::vector<Entry>& GetEntries() const { return m_Entries; }
+
+        size_t Size() const { return m_Packets.size(); }
+        bool Empty() const { return m_Packets.empty(); }
+
+    private:
+        // Compact per-frame IDs so keys stay small regardless of pointer values
+        static uint32_t GetResourceID(std::unordered_map<const void*, uint32_t>& ids, const void* resource);
+        // Pooled meshes share a vertex array, so they are told apart by their first index
+        uint32_t GetMeshID(const DrawPacket& packet);
+
+    private:
+        std::vector<DrawPacket> m_Packets;
+        std::vector<Entry> m_Entries;
+
+        std::unordered_map<const void*, uint32_t> m_ShaderIDs;
+        std::unordered_map<const void*, uint32_t> m_MaterialIDs;
+        std::map<std::pair<const void*, uint32_t>, uint32_t> m_MeshIDs;
+    };
+
+}
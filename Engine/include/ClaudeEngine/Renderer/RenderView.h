@@ -0,0 +1,33 @@
+#pragma once
+
+#include "ClaudeEngine/Renderer/EditorCamera.h"
+#include "ClaudeEngine/Renderer/Frustum.h"
+#include <glm/glm.hpp>
+
+namespace ClaudeEngine {
+
+    // Camera state a frame is culled and sorted against. Plain data, so it can be captured on one
+    // thread and used on another.
+    struct RenderView {
+        glm::mat4 ViewProjectionMatrix = glm::mat4(1.0f);
+        glm::mat4 ViewMatrix = glm::mat4(1.0f);
+        glm::mat4 ProjectionMatrix = glm::mat4(1.0f);
+        float NearClip = 0.1f;
+        float FarClip = 1000.0f;
+        glm::vec3 CameraPosition = glm::vec3(0.0f);
+        Frustum ViewFrustum;
+
+        static RenderView FromCamera(const EditorCamera& camera) {
+            RenderView view;
+            view.ViewMatrix = camera.GetViewMatrix();
+            view.ProjectionMatrix = camera.GetProjection();
+            view.ViewProjectionMatrix = camera.GetViewProjection();
+            view.NearClip = 0.1f; // Match camera settings
+            view.FarClip = 1000.0f;
+            view.CameraPosition = camera.GetPosition();
+            view.ViewFrustum.Update(view.ViewProjectionMatrix);
+            return view;
+        }
+    };
+
+}
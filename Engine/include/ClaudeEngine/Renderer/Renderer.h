@@ -4,10 +4,35 @@
 #include "RenderCommand.h"
 #include "Shader.h"
 #include "Camera.h"
+#include "UniformBuffer.h"
+#include "StreamBuffer.h"
 #include <glm/glm.hpp>
 
 namespace ClaudeEngine {
 
+    // Binding points shared with the bundled GLSL
+    enum BufferBinding : uint32_t {
+        CameraBinding = 0,          // uniform Camera (std140)
+        InstanceBinding = 1,        // buffer Instances (std430)
+        MaterialBinding = 2,        // uniform MaterialParameters (std140)
+        IndirectBinding = 3,        // buffer BatchCommands (std430), also the draw indirect buffer
+        CullRecordBinding = 4,      // buffer CullRecords (std430), GPU culling input
+        VisibleCommandBinding = 5,  // buffer VisibleCommands (std430), GPU culling output
+        DrawGroupBinding = 6,       // buffer DrawGroups (std430), per-group draw counts
+        CullStatsBinding = 7        // buffer CullStatistics (std430), GPU occlusion counters
+    };
+
+    // Matches the std140 Camera block
+    struct CameraData {
+        glm::mat4 ViewProjection;
+        glm::mat4 View;
+        glm::mat4 Projection;
+        glm::vec4 Position;
+        float NearClip;
+        float FarClip;
+        float Padding[2];
+    };
+
     class Renderer {
     public:
         static void Init();
@@ -18,6 +43,14 @@ namespace ClaudeEngine {
         static void BeginScene(Camera& camera);
         static void EndScene();
 
+        // Writes the camera block into the stream buffer and binds it to CameraBinding
+        static void SetCameraData(const CameraData& data);
+
+        // Ring shared by everything rewritten each frame
+        static const Ref<StreamBuffer>& GetStreamBuffer() { return s_SceneData->FrameStream; }
+        // Called once the frame's commands are issued, before the swap
+        static void EndFrame();
+
         static void Submit(const Ref<Shader>& shader, 
                           const Ref<VertexArray>& vertexArray,
                           const glm::mat4& transform = glm::mat4(1.0f));
@@ -27,8 +60,11 @@ namespace ClaudeEngine {
     private:
         struct SceneData {
             glm::mat4 ViewProjectionMatrix;
+            Ref<StreamBuffer> FrameStream;
         };
 
+        static const uint32_t StreamBufferSize = 16 * 1024 * 1024;
+
         static Scope<SceneData> s_SceneData;
     };
 
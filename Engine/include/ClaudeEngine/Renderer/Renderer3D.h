@@ -4,6 +4,9 @@
 #include "ClaudeEngine/Renderer/Shader.h"
 #include "ClaudeEngine/Renderer/VertexArray.h"
 #include "ClaudeEngine/Renderer/EditorCamera.h"
+#include "ClaudeEngine/Renderer/RenderView.h"
+#include "ClaudeEngine/Renderer/Frustum.h"
+#include "ClaudeEngine/Renderer/FrustumCuller.h"
 #include "ClaudeEngine/Scene/Scene.h"
 #include <glm/glm.hpp>
 
@@ -11,6 +14,9 @@ namespace ClaudeEngine {
 
     // Forward declarations
     class Model;
+    class Material;
+    class Framebuffer;
+    class RenderCommandList;
 
     class Renderer3D {
     public:
@@ -18,29 +24,114 @@ namespace ClaudeEngine {
         static void Shutdown();
 
         // Begin/End scene with editor camera
+        // Draws are queued between BeginScene and EndScene, then sorted and flushed in EndScene
         static void BeginScene(const EditorCamera& camera);
+        static void BeginScene(const RenderView& view);
         static void EndScene();
 
         // Primitives
         static void DrawGrid();
         static void DrawCube(const glm::mat4& transform, const glm::vec4& color = glm::vec4(1.0f));
-        static void DrawModel(const Ref<Model>& model, const glm::mat4& transform);
+        // worldBounds enables meshlet culling; leave it invalid for models that must never be culled.
+        // cullOnGPU hands the draw to the GPU cull pass, which then tests worldBounds, so callers that
+        // cull on the CPU leave it off. Meshes with fewer LODs than lod draw their coarsest one.
+        static void DrawModel(const Ref<Model>& model, const glm::mat4& transform, const Ref<Material>& material = nullptr,
+                              const AABB& worldBounds = AABB(), uint32_t lod = 0, bool cullOnGPU = false);
+
+        // Entity ID pass: draws the model's LOD 0 writing entityID to the bound framebuffer's first
+        // attachment, which must be RED_INTEGER. Read the IDs back with Framebuffer::ReadPixelsAsync.
+        static void DrawEntityID(const Ref<Model>& model, const glm::mat4& transform, int entityID);
+
+        // Replays a list recorded on another thread into the frame's queue and clears it; GL thread only
+        static void SubmitCommandList(RenderCommandList& commandList);
+
+        // Level of detail for bounds seen from the BeginScene camera, given the level used last frame
+        static uint32_t SelectLOD(const AABB& worldBounds, uint32_t currentLevel, uint32_t levelCount);
+
+        // Culling against the frustum captured in BeginScene; records visible/culled stats
+        static bool IsVisible(const AABB& worldBounds);
+        // Batched variant over a SoA cache; entries with cullable[i] == 0 are always visible
+        static void CullBounds(const BoundsSoA& bounds, const uint8_t* cullable, std::vector<uint8_t>& visibility);
+        static const Frustum& GetFrustum();
+
+        // Meshlet culling: LOD 0 of split meshes is culled per cluster against the frustum and
+        // the clusters' normal cones, and only the surviving index ranges are drawn. Applies to
+        // models drawn with valid world bounds.
+        static void SetMeshletCulling(bool enabled);
+        static bool IsMeshletCullingEnabled();
+
+        // GPU-driven culling: a compute pass tests every opaque instance against the frustum and
+        // compacts the survivors into draw commands consumed by an indirect-count multi-draw.
+        // Falls back to the CPU path when compute or indirect-count draws are unavailable.
+        static void SetGPUCulling(bool enabled);
+        static bool IsGPUCullingSupported();
+        static bool IsGPUCullingActive();
+
+        // Hi-Z occlusion culling: large occluders are drawn depth-only before the main pass and the
+        // result is reduced into a depth pyramid. With GPU culling active the cull pass tests opaque
+        // instances against it in the same frame; otherwise IsOccluded tests against a CPU copy
+        // that lags a few frames behind.
+        static void SetOcclusionCulling(bool enabled);
+        static bool IsOcclusionCullingSupported();
+        static bool IsOcclusionCullingActive();
+        // Inside the frustum and large on screen; false once the occluder budget is used up
+        static bool IsOccluderCandidate(const AABB& worldBounds);
+        // lod must match the main pass draw, whose depth has to equal the pre-pass depth
+        static void DrawOccluder(const Ref<Model>& model, const glm::mat4& transform, uint32_t lod = 0);
+        // Renders the queued occluders into the bound framebuffer's depth and builds the pyramid from it
+        static void BuildOcclusionPyramid(const Ref<Framebuffer>& framebuffer);
+        // CPU test against the latest pyramid readback; records occluded stats
+        static bool IsOccluded(const AABB& worldBounds);
 
         // Gizmos
         static void DrawGizmo(const glm::mat4& transform, int gizmoOperation, int gizmoMode);
 
         // Stats
         struct Statistics {
-            uint32_t DrawCalls = 0;
+            uint32_t DrawCalls = 0;         // Multi-draw submissions
+            uint32_t IndirectCommands = 0;  // Instanced draws packed into them
+            // Submitted geometry, counted before GPU culling drops any of it
             uint32_t Vertices = 0;
             uint32_t Triangles = 0;
+            uint32_t Instances = 0;
+
+            // Render queue
+            uint32_t SubmittedPackets = 0;
+            uint32_t CommandLists = 0;      // Recorded off the GL thread and replayed
+            uint32_t FallbackDraws = 0;     // Drawn with the fallback while their shader compiles
+            uint32_t ShaderBinds = 0;
+            uint32_t MaterialBinds = 0;
+            uint32_t VertexArrayBinds = 0;
+            uint32_t StateChangesAvoided = 0;
+
+            // Culling
+            uint32_t VisibleObjects = 0;
+            uint32_t CulledObjects = 0;
+            uint32_t Occluders = 0;
+            uint32_t OccludedObjects = 0;   // GPU passes report theirs a few frames late, each once
+            uint32_t VisibleMeshlets = 0;
+            uint32_t FrustumCulledMeshlets = 0;
+            uint32_t BackfaceCulledMeshlets = 0;
+
+            // GL state shadow cache
+            uint32_t StateCallsIssued = 0;
+            uint32_t StateCallsFiltered = 0;
         };
         static Statistics GetStats();
         static void ResetStats();
+        // Shaders that failed to compile or link, by name; their draws use the fallback for good
+        static const std::vector<std::string>& GetFailedShaders();
 
     private:
         static void InitGrid();
         static void InitCube();
+        static void InitFallbackShader();
+        static void InitInstancing();
+        static void InitGPUCulling();
+        static void InitOcclusionCulling();
+        static void InitEntityIDs();
+
+        static void Flush();
     };
 
 }
@@ -4,9 +4,24 @@
 #include <string>
 #include <glm/glm.hpp>
 #include <unordered_map>
+#include <vector>
+#include <cstdint>
 
 namespace ClaudeEngine {
 
+    // Interned uniform name, valid across every shader. Resolve once and keep it
+    // (e.g. in a static) so per-draw uploads skip string hashing entirely
+    using UniformHandle = uint32_t;
+
+    // Bit i set enables the i-th keyword of the shader's "#pragma features" line
+    using ShaderFeatureMask = uint32_t;
+
+    enum class ShaderStatus {
+        Compiling, // Started by CreateAsync and not finished yet
+        Ready,
+        Failed
+    };
+
     class Shader {
     public:
         virtual ~Shader() = default;
@@ -22,9 +37,36 @@ namespace ClaudeEngine {
         virtual void SetFloat4(const std::string& name, const glm::vec4& value) = 0;
         virtual void SetMat4(const std::string& name, const glm::mat4& value) = 0;
 
+        virtual void SetInt(UniformHandle handle, int value) = 0;
+        virtual void SetFloat(UniformHandle handle, float value) = 0;
+        virtual void SetFloat2(UniformHandle handle, const glm::vec2& value) = 0;
+        virtual void SetFloat3(UniformHandle handle, const glm::vec3& value) = 0;
+        virtual void SetFloat4(UniformHandle handle, const glm::vec4& value) = 0;
+        virtual void SetMat4(UniformHandle handle, const glm::mat4& value) = 0;
+
+        virtual bool HasUniform(UniformHandle handle) = 0;
+
         virtual const std::string& GetName() const = 0;
 
+        // Never waits on the driver; a shader seen Compiling here is safe to use but may stall
+        virtual ShaderStatus GetStatus() = 0;
+        bool IsReady() { return GetStatus() == ShaderStatus::Ready; }
+
+        // Keywords declared with "#pragma features A B ..." anywhere in the source, at most 32
+        virtual const std::vector<std::string>& GetFeatures() const = 0;
+        // 0 when the shader does not declare the keyword
+        ShaderFeatureMask GetFeatureMask(const std::string& feature) const;
+        // The permutation with the masked keywords #defined, compiled asynchronously on first request
+        // and kept for the shader's lifetime. An empty mask is the shader itself.
+        virtual Shader* GetVariant(ShaderFeatureMask features) = 0;
+
+        static UniformHandle GetUniformHandle(const std::string& name);
+        static const std::string& GetUniformName(UniformHandle handle);
+
         static Ref<Shader> Create(const std::string& filepath);
+        // Returns as soon as compiling has started; poll GetStatus to find out when it is done.
+        // Starting several before checking any lets the driver compile them in parallel.
+        static Ref<Shader> CreateAsync(const std::string& filepath);
         static Ref<Shader> Create(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
     };
 
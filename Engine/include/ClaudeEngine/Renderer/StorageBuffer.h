@@ -0,0 +1,39 @@
+#pragma once
+
+#include "ClaudeEngine/Core/Core.h"
+#include <cstdint>
+
+namespace ClaudeEngine {
+
+    // Persistently mapped shader storage buffer split into one fenced segment per frame in flight.
+    // Each frame sub-allocates its segment while the GPU may still be reading the others.
+    // GPU-only buffers have a single unmapped segment that shaders fill.
+    class StorageBuffer {
+    public:
+        virtual ~StorageBuffer() = default;
+
+        // Reserves size bytes of the frame's segment, binds them to the storage binding point and
+        // returns their mapped memory (nullptr for GPU-only buffers, which always bind from 0).
+        // The first allocation of a frame waits until the GPU is done with the segment; a frame
+        // that outgrows its segment continues in the next one, which may wait too.
+        virtual void* Allocate(uint32_t size) = 0;
+
+        virtual uint32_t GetSegmentSize() const = 0;
+        virtual uint32_t GetSegmentCount() const = 0;
+        // Byte offset of the latest allocation from the start of the buffer
+        virtual uint32_t GetAllocationOffset() const = 0;
+
+        virtual uint32_t GetRendererID() const = 0;
+
+        // Synchronous readback relative to the latest allocation; for tests and tools
+        virtual void GetData(void* data, uint32_t size, uint32_t offset = 0) const = 0;
+
+        static Ref<StorageBuffer> Create(uint32_t segmentSize, uint32_t segmentCount, uint32_t binding);
+        static Ref<StorageBuffer> CreateGPUOnly(uint32_t size, uint32_t binding);
+
+        // Fences the frame's segment of every mapped storage buffer and moves them on to the next.
+        // Called by Renderer::EndFrame once the frame's commands are issued.
+        static void EndFrame();
+    };
+
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "ClaudeEngine/Core/Core.h"
+#include <cstdint>
+
+namespace ClaudeEngine {
+
+    // Sub-range of a StreamBuffer. Writable until the frame it was allocated in is ended.
+    struct StreamAllocation {
+        void* Data = nullptr;
+        uint32_t Offset = 0;  // Bytes from the start of the buffer
+        uint32_t Size = 0;
+    };
+
+    // Persistently mapped ring for data rewritten every frame: per-draw uniforms, instance data,
+    // debug and particle geometry. Writes land directly in GPU-visible memory with no driver copy.
+    // Each frame's span is fenced, so the CPU only waits when the ring wraps onto a frame the GPU
+    // has not finished reading.
+    class StreamBuffer {
+    public:
+        // Decides the offset alignment of an allocation and where Bind attaches it
+        enum class Usage {
+            Uniform,
+            Storage,
+            Vertex   // Read through GetRendererID() and the allocation offset
+        };
+
+        struct Statistics {
+            uint32_t Size = 0;
+            uint32_t FrameBytes = 0;      // Allocated during the last ended frame, padding included
+            uint32_t PeakFrameBytes = 0;
+            uint32_t Wraps = 0;
+            uint32_t Stalls = 0;          // Allocations that had to wait for the GPU
+        };
+
+        virtual ~StreamBuffer() = default;
+
+        // Never fails for sizes up to half the ring size; blocks if the GPU still owns the space
+        virtual StreamAllocation Allocate(uint32_t size, Usage usage) = 0;
+        // Attaches an allocation to an indexed uniform or storage binding point
+        virtual void Bind(Usage usage, uint32_t binding, const StreamAllocation& allocation) = 0;
+        // Fences everything allocated since the previous call, after the frame's draws were issued
+        virtual void EndFrame() = 0;
+
+        virtual uint32_t GetRendererID() const = 0;
+        virtual const Statistics& GetStats() const = 0;
+
+        static Ref<StreamBuffer> Create(uint32_t size);
+    };
+
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "ClaudeEngine/Renderer/Frustum.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace ClaudeEngine {
+
+    struct Vertex;
+
+    struct RayHit {
+        float Distance = 0.0f;           // In units of the ray direction's length
+        uint32_t Triangle = 0;           // Index into the source index list, divided by three
+        glm::vec2 Barycentrics = glm::vec2(0.0f); // Weights of the second and third corner
+    };
+
+    // Static bounding volume hierarchy over a mesh's triangles, built once with binned SAH splits.
+    // Keeps its own copy of the positions so it does not depend on the mesh staying alive.
+    class TriangleBVH {
+    public:
+        TriangleBVH() = default;
+        TriangleBVH(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
+
+        // Closest hit within maxDistance. Both faces count, since the renderer draws both.
+        bool Intersect(const Ray& ray, float maxDistance, RayHit& hit) const;
+
+        uint32_t GetTriangleCount() const { return (uint32_t)m_Triangles.size(); }
+        uint32_t GetNodeCount() const { return (uint32_t)m_Nodes.size(); }
+        const AABB& GetBounds() const { return m_Nodes.empty() ? s_EmptyBounds : m_Nodes[0].Bounds; }
+
+    private:
+        static constexpr uint32_t MaxLeafTriangles = 4;
+        static constexpr uint32_t BinCount = 12;
+
+        // Leaves have a non-zero Count and own [First, First + Count) of m_Triangles;
+        // inner nodes keep their children at First and First + 1
+        struct Node {
+            AABB Bounds;
+            uint32_t First = 0;
+            uint32_t Count = 0;
+        };
+
+        struct Triangle {
+            glm::vec3 P0, Edge1, Edge2;
+            uint32_t Index;
+        };
+
+        void Subdivide(uint32_t nodeIndex, std::vector<glm::vec3>& centroids);
+
+    private:
+        std::vector<Node> m_Nodes;
+        std::vector<Triangle> m_Triangles;
+
+        static const AABB s_EmptyBounds;
+    };
+
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "ClaudeEngine/Core/Core.h"
+#include <cstdint>
+
+namespace ClaudeEngine {
+
+    class UniformBuffer {
+    public:
+        virtual ~UniformBuffer() = default;
+
+        virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+
+        // Rebinds the buffer to its binding point, for buffers that share one (e.g. per-material blocks)
+        virtual void Bind() const = 0;
+
+        // Buffer is bound to the given uniform block binding point on creation
+        static Ref<UniformBuffer> Create(uint32_t size, uint32_t binding);
+    };
+
+}
@@ -14,6 +14,9 @@ namespace ClaudeEngine {
         virtual void Unbind() const = 0;
 
         virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) = 0;
+        // Repoints a slot (in AddVertexBuffer order) at another buffer with the same layout, so
+        // meshes with identical layouts can share one vertex array
+        virtual void SetVertexBuffer(uint32_t slot, const Ref<VertexBuffer>& vertexBuffer) = 0;
         virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) = 0;
 
         virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const = 0;
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "ClaudeEngine/Renderer/Buffer.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace ClaudeEngine {
+
+    struct Vertex;
+
+    // How mesh vertices are stored on the GPU. Every format keeps the same attribute locations
+    // (position 0, normal 1, texcoords 2, tangent 3) so shaders can read all of them; shaders that
+    // use normals or tangents decode them according to u_VertexFormat.
+    enum class VertexFormat : uint8_t {
+        Standard = 0,   // Vertex as-is, 56 bytes
+        Packed,         // Float positions, octahedral snorm16 normal/tangent, half UVs: 28 bytes
+        PackedQuantized // As Packed with snorm16 positions in the mesh bounds: 20 bytes
+    };
+    constexpr uint32_t VertexFormatCount = 3;
+
+    // Bitangents are rebuilt as cross(N, T) * sign, with the sign in the position's w
+    struct PackedVertex {
+        glm::vec4 Position;
+        int16_t Normal[2];
+        uint16_t TexCoords[2];
+        int16_t Tangent[2];
+    };
+
+    struct QuantizedVertex {
+        int16_t Position[4];
+        int16_t Normal[2];
+        uint16_t TexCoords[2];
+        int16_t Tangent[2];
+    };
+
+    const char* VertexFormatToString(VertexFormat format);
+    uint32_t GetVertexFormatStride(VertexFormat format);
+    BufferLayout GetVertexFormatLayout(VertexFormat format);
+
+    // Encodes vertices into the given format. Returns the model-space transform the stored
+    // positions need, which is identity unless positions are quantized.
+    glm::mat4 PackVertices(const std::vector<Vertex>& vertices, VertexFormat format, std::vector<uint8_t>& packed);
+
+}
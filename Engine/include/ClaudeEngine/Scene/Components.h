@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ClaudeEngine/Core/Core.h"
+
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -67,7 +69,8 @@ namespace ClaudeEngine {
         // Enhanced features
         bool Visible = true;
         bool FrustumCulling = true;
-        int LODLevel = 0; // Level of Detail (0 = highest quality)
+        int LODLevel = 0; // Level of Detail (0 = highest quality); the finest level drawn
+        uint32_t SelectedLOD = 0; // Runtime: level picked by screen size each frame, never finer than LODLevel
         
         // Bounding box for culling
         glm::vec3 BoundingBoxMin = { -0.5f, -0.5f, -0.5f };
@@ -80,7 +83,7 @@ namespace ClaudeEngine {
 
         MeshRendererComponent() = default;
         MeshRendererComponent(const MeshRendererComponent&) = default;
-        MeshRendererComponent(const Ref<Model>& model) : ModelAsset(model) {}
+        MeshRendererComponent(const Ref<Model>& model) : ModelAsset(model) { CalculateBoundingBox(); }
         MeshRendererComponent(const std::string& path) : ModelPath(path) {}
         
         // Calculate bounding box from model
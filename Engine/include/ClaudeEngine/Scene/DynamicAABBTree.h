@@ -0,0 +1,155 @@
+#pragma once
+
+#include "ClaudeEngine/Renderer/Frustum.h"
+#include <cstdint>
+#include <vector>
+
+namespace ClaudeEngine {
+
+    // Incrementally updated bounding volume hierarchy over fattened AABBs.
+    // Leaves are proxies; moving a proxy only reinserts it once it leaves its fat box.
+    class DynamicAABBTree {
+    public:
+        static constexpr int32_t NullNode = -1;
+
+        DynamicAABBTree(float margin = 0.1f);
+
+        int32_t CreateProxy(const AABB& box, uint32_t userData);
+        void DestroyProxy(int32_t proxyID);
+
+        // Returns true if the proxy was reinserted. Displacement extends the fat box along the motion
+        bool MoveProxy(int32_t proxyID, const AABB& box, const glm::vec3& displacement = glm::vec3(0.0f));
+
+        uint32_t GetUserData(int32_t proxyID) const { return m_Nodes[proxyID].UserData; }
+        const AABB& GetFatAABB(int32_t proxyID) const { return m_Nodes[proxyID].Box; }
+
+        // Callbacks receive the proxy ID and return false to stop the query
+        template<typename Callback>
+        void Query(const AABB& box, Callback&& callback) const;
+
+        template<typename Callback>
+        void Query(const Frustum& frustum, Callback&& callback) const;
+
+        // Callback receives (proxyID, entryDistance) and returns the new max distance:
+        // the same value to continue, a smaller one to clip, or 0 to stop
+        template<typename Callback>
+        void RayCast(const Ray& ray, float maxDistance, Callback&& callback) const;
+
+        void Clear();
+
+        uint32_t GetProxyCount() const { return m_ProxyCount; }
+        int32_t GetHeight() const { return m_Root == NullNode ? 0 : m_Nodes[m_Root].Height; }
+        float GetMargin() const { return m_Margin; }
+
+    private:
+        struct Node {
+            AABB Box;
+            union {
+                int32_t Parent;
+                int32_t Next; // Free list link
+            };
+            int32_t Child1 = NullNode;
+            int32_t Child2 = NullNode;
+            int32_t Height = -1; // -1 marks a free node, 0 a leaf
+            uint32_t UserData = 0;
+
+            Node() : Parent(NullNode) {}
+            bool IsLeaf() const { return Child1 == NullNode; }
+        };
+
+        int32_t AllocateNode();
+        void FreeNode(int32_t node);
+
+        void InsertLeaf(int32_t leaf);
+        void RemoveLeaf(int32_t leaf);
+        int32_t Balance(int32_t node);
+
+    private:
+        std::vector<Node> m_Nodes;
+        int32_t m_Root = NullNode;
+        int32_t m_FreeList = NullNode;
+        uint32_t m_ProxyCount = 0;
+        float m_Margin;
+    };
+
+    template<typename Callback>
+    void DynamicAABBTree::Query(const AABB& box, Callback&& callback) const {
+        if (m_Root == NullNode)
+            return;
+
+        std::vector<int32_t> stack;
+        stack.reserve(64);
+        stack.push_back(m_Root);
+        while (!stack.empty()) {
+            int32_t nodeID = stack.back();
+            stack.pop_back();
+
+            const Node& node = m_Nodes[nodeID];
+            if (!node.Box.Overlaps(box))
+                continue;
+
+            if (node.IsLeaf()) {
+                if (!callback(nodeID))
+                    return;
+            } else {
+                stack.push_back(node.Child1);
+                stack.push_back(node.Child2);
+            }
+        }
+    }
+
+    template<typename Callback>
+    void DynamicAABBTree::Query(const Frustum& frustum, Callback&& callback) const {
+        if (m_Root == NullNode)
+            return;
+
+        std::vector<int32_t> stack;
+        stack.reserve(64);
+        stack.push_back(m_Root);
+        while (!stack.empty()) {
+            int32_t nodeID = stack.back();
+            stack.pop_back();
+
+            const Node& node = m_Nodes[nodeID];
+            if (!frustum.Intersects(node.Box))
+                continue;
+
+            if (node.IsLeaf()) {
+                if (!callback(nodeID))
+                    return;
+            } else {
+                stack.push_back(node.Child1);
+                stack.push_back(node.Child2);
+            }
+        }
+    }
+
+    template<typename Callback>
+    void DynamicAABBTree::RayCast(const Ray& ray, float maxDistance, Callback&& callback) const {
+        if (m_Root == NullNode)
+            return;
+
+        std::vector<int32_t> stack;
+        stack.reserve(64);
+        stack.push_back(m_Root);
+        while (!stack.empty()) {
+            int32_t nodeID = stack.back();
+            stack.pop_back();
+
+            const Node& node = m_Nodes[nodeID];
+            float distance;
+            if (!node.Box.Intersects(ray, maxDistance, distance))
+                continue;
+
+            if (node.IsLeaf()) {
+                maxDistance = callback(nodeID, distance);
+                if (maxDistance <= 0.0f)
+                    return;
+            } else {
+                stack.push_back(node.Child1);
+                stack.push_back(node.Child2);
+            }
+        }
+    }
+
+}
@@ -1,13 +1,26 @@
 #pragma once
 
 #include "ClaudeEngine/Core/Core.h"
+#include "ClaudeEngine/Scene/DynamicAABBTree.h"
 #include <entt/entt.hpp>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ClaudeEngine {
 
     class Entity;
+    struct BoundsSoA;
+
+    // World-space bounds for every transformable entity, rebuilt by Scene::UpdateBoundsCache
+    struct SceneBoundsCache {
+        SceneBoundsCache();
+        ~SceneBoundsCache();
+
+        std::vector<entt::entity> Entities;
+        std::vector<uint8_t> Cullable; // 0 when MeshRendererComponent::FrustumCulling is off
+        Scope<BoundsSoA> Bounds;       // See Renderer/FrustumCuller.h
+    };
 
     class Scene {
     public:
@@ -31,9 +44,37 @@ namespace ClaudeEngine {
         Entity FindEntityByTag(const std::string& tag);
         std::vector<Entity> FindEntitiesByTag(const std::string& tag);
 
+        // Recomputes world bounds, refreshing the SoA cache and refitting the spatial index
+        void UpdateBoundsCache();
+        const SceneBoundsCache& GetBoundsCache() const { return m_BoundsCache; }
+
+        // Spatial queries against the world bounds from the last UpdateBoundsCache
+        void QueryFrustum(const Frustum& frustum, std::vector<entt::entity>& result) const;
+        void QueryBox(const AABB& box, std::vector<entt::entity>& result) const;
+        entt::entity Raycast(const Ray& ray, float maxDistance, float* hitDistance = nullptr) const;
+        // Like Raycast, but entities with a loaded model are hit by their triangles; the rest
+        // still by their bounds. ray.Direction should be normalized for a world-space distance.
+        entt::entity Pick(const Ray& ray, float maxDistance, float* hitDistance = nullptr) const;
+
+        const DynamicAABBTree& GetSpatialIndex() const { return m_SpatialIndex; }
+
+    private:
+        void SyncSpatialProxy(entt::entity entity, const AABB& worldBounds);
+        void OnTransformDestroyed(entt::registry& registry, entt::entity entity);
+
     private:
         std::string m_Name;
         entt::registry m_Registry;
+        SceneBoundsCache m_BoundsCache;
+
+        // Spatial index, keyed by entity; exact bounds are kept per proxy to filter fat-box hits
+        struct SpatialProxy {
+            int32_t ProxyID;
+            glm::vec3 LastCenter;
+        };
+        DynamicAABBTree m_SpatialIndex;
+        std::unordered_map<uint32_t, SpatialProxy> m_SpatialProxies;
+        std::vector<AABB> m_ProxyBounds;
 
         friend class Entity;
     };
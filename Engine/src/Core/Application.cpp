@@ -1,5 +1,6 @@
 #include "ClaudeEngine/Core/Application.h"
 #include "ClaudeEngine/Core/Log.h"
+#include "ClaudeEngine/Core/JobSystem.h"
 #include "ClaudeEngine/Renderer/Renderer.h"
 #include "ClaudeEngine/Events/ApplicationEvent.h"
 
@@ -22,6 +23,7 @@ namespace ClaudeEngine {
         m_Window = Window::Create(WindowProps(name));
         m_Window->SetEventCallback(CE_BIND_EVENT_FN(Application::OnEvent));
 
+        JobSystem::Init();
         Renderer::Init();
 
         // Initialize ImGui
@@ -53,6 +55,7 @@ namespace ClaudeEngine {
         ImGui::DestroyContext();
 
         Renderer::Shutdown();
+        JobSystem::Shutdown();
     }
 
     void Application::Run() {
@@ -86,6 +89,8 @@ namespace ClaudeEngine {
                     ImGui::RenderPlatformWindowsDefault();
                     glfwMakeContextCurrent(backup_current_context);
                 }
+
+                Renderer::EndFrame();
             }
 
             m_Window->OnUpdate();
@@ -0,0 +1,135 @@
+#include "ClaudeEngine/Core/JobSystem.h"
+#include "ClaudeEngine/Core/Log.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ClaudeEngine {
+
+    namespace {
+
+        struct JobSystemData {
+            std::vector<std::thread> Workers;
+            // Held for a whole ParallelFor, so callers on different threads take turns
+            std::mutex DispatchMutex;
+            std::mutex Mutex;
+            std::condition_variable WakeCondition;
+            std::condition_variable DoneCondition;
+            bool Quit = false;
+
+            // The current ParallelFor; Generation tells sleeping workers a new one was posted
+            uint64_t Generation = 0;
+            const JobSystem::RangeJob* Job = nullptr;
+            uint32_t Count = 0;
+            uint32_t GrainSize = 1;
+            uint32_t RangeCount = 0;
+            std::atomic<uint32_t> NextRange{ 0 };
+            uint32_t BusyWorkers = 0;
+        };
+
+    }
+
+    static JobSystemData* s_JobData = nullptr;
+
+    // Ranges are claimed one at a time, so uneven ranges balance out across threads
+    static void RunRanges(uint32_t thread) {
+        JobSystemData& data = *s_JobData;
+        for (;;) {
+            uint32_t range = data.NextRange.fetch_add(1, std::memory_order_relaxed);
+            if (range >= data.RangeCount)
+                return;
+            uint32_t begin = range * data.GrainSize;
+            uint32_t end = std::min(begin + data.GrainSize, data.Count);
+            (*data.Job)(begin, end, thread);
+        }
+    }
+
+    static void WorkerLoop(uint32_t thread) {
+        JobSystemData& data = *s_JobData;
+        uint64_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(data.Mutex);
+                data.WakeCondition.wait(lock, [&] { return data.Quit || data.Generation != seen; });
+                if (data.Quit)
+                    return;
+                seen = data.Generation;
+            }
+
+            RunRanges(thread);
+
+            std::lock_guard<std::mutex> lock(data.Mutex);
+            if (--data.BusyWorkers == 0)
+                data.DoneCondition.notify_one();
+        }
+    }
+
+    void JobSystem::Init(uint32_t threadCount) {
+        CE_CORE_ASSERT(!s_JobData, "JobSystem already initialized!");
+        if (threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        s_JobData = new JobSystemData();
+        for (uint32_t i = 1; i < threadCount; i++)
+            s_JobData->Workers.emplace_back(WorkerLoop, i);
+
+        CE_CORE_INFO("JobSystem: ", threadCount, " threads");
+    }
+
+    void JobSystem::Shutdown() {
+        if (!s_JobData)
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(s_JobData->Mutex);
+            s_JobData->Quit = true;
+        }
+        s_JobData->WakeCondition.notify_all();
+        for (auto& worker : s_JobData->Workers)
+            worker.join();
+
+        delete s_JobData;
+        s_JobData = nullptr;
+    }
+
+    uint32_t JobSystem::GetThreadCount() {
+        return s_JobData ? (uint32_t)s_JobData->Workers.size() + 1 : 1;
+    }
+
+    void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize, const RangeJob& job) {
+        if (count == 0)
+            return;
+
+        grainSize = std::max(grainSize, 1u);
+        const uint32_t rangeCount = (count + grainSize - 1) / grainSize;
+        if (!s_JobData || s_JobData->Workers.empty() || rangeCount == 1) {
+            job(0, count, 0);
+            return;
+        }
+
+        JobSystemData& data = *s_JobData;
+        std::lock_guard<std::mutex> dispatch(data.DispatchMutex);
+        {
+            std::lock_guard<std::mutex> lock(data.Mutex);
+            data.Job = &job;
+            data.Count = count;
+            data.GrainSize = grainSize;
+            data.RangeCount = rangeCount;
+            data.NextRange.store(0, std::memory_order_relaxed);
+            data.BusyWorkers = (uint32_t)data.Workers.size();
+            data.Generation++;
+        }
+        data.WakeCondition.notify_all();
+
+        RunRanges(0);
+
+        // Every worker checks in, even those that found no range left, so none can see a stale job
+        std::unique_lock<std::mutex> lock(data.Mutex);
+        data.DoneCondition.wait(lock, [&] { return data.BusyWorkers == 0; });
+        data.Job = nullptr;
+    }
+
+}
@@ -1,58 +1,115 @@
 #include "ClaudeEngine/Platform/OpenGL/OpenGLBuffer.h"
+#include "ClaudeEngine/Platform/OpenGL/OpenGLRenderAPI.h"
 #include <glad/glad.h>
+#include <cstring>
 
 namespace ClaudeEngine {
 
+    static GLbitfield BufferUsageToStorageFlags(BufferUsage usage) {
+        switch (usage) {
+            case BufferUsage::Static:   return 0;
+            case BufferUsage::Dynamic:  return GL_DYNAMIC_STORAGE_BIT;
+            case BufferUsage::Stream:   return GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            case BufferUsage::Readback: return GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT | GL_CLIENT_STORAGE_BIT;
+        }
+        return GL_DYNAMIC_STORAGE_BIT;
+    }
+
+    // Immutable storage through DSA, so creating a buffer never disturbs the bound vertex array.
+    // Returns the persistent mapping for Stream and Readback buffers.
+    static uint8_t* CreateBufferStorage(uint32_t& rendererID, uint32_t size, const void* data, BufferUsage usage) {
+        const GLbitfield flags = BufferUsageToStorageFlags(usage);
+        glCreateBuffers(1, &rendererID);
+        glNamedBufferStorage(rendererID, size, data, flags);
+        if (!(flags & GL_MAP_PERSISTENT_BIT))
+            return nullptr;
+
+        uint8_t* mapped = (uint8_t*)glMapNamedBufferRange(rendererID, 0, size, flags & ~GL_CLIENT_STORAGE_BIT);
+        CE_CORE_ASSERT(mapped, "Failed to persistently map buffer!");
+        return mapped;
+    }
+
+    static void WriteBufferStorage(uint32_t rendererID, uint8_t* mapped, BufferUsage usage, uint32_t offset, uint32_t size, const void* data) {
+        CE_CORE_ASSERT(usage == BufferUsage::Dynamic || usage == BufferUsage::Stream, "Buffer storage is not CPU-writable!");
+        if (mapped)
+            std::memcpy(mapped + offset, data, size);
+        else
+            glNamedBufferSubData(rendererID, offset, size, data);
+    }
+
+    static void DestroyBufferStorage(uint32_t rendererID, uint8_t* mapped) {
+        if (mapped)
+            glUnmapNamedBuffer(rendererID);
+        glDeleteBuffers(1, &rendererID);
+        OpenGLRenderAPI::GetStateCache().OnBufferDeleted(rendererID);
+    }
+
     // ===== Vertex Buffer =====
 
-    OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size) {
-        glCreateBuffers(1, &m_RendererID);
-        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
-        glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+    OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size, BufferUsage usage)
+        : m_Size(size), m_Usage(usage) {
+        m_MappedData = CreateBufferStorage(m_RendererID, size, nullptr, usage);
     }
 
-    OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size) {
-        glCreateBuffers(1, &m_RendererID);
-        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
-        glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+    OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size, BufferUsage usage)
+        : m_Size(size), m_Usage(usage) {
+        m_MappedData = CreateBufferStorage(m_RendererID, size, vertices, usage);
     }
 
     OpenGLVertexBuffer::~OpenGLVertexBuffer() {
-        glDeleteBuffers(1, &m_RendererID);
+        DestroyBufferStorage(m_RendererID, m_MappedData);
     }
 
     void OpenGLVertexBuffer::Bind() const {
-        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        OpenGLRenderAPI::GetStateCache().BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
     }
 
     void OpenGLVertexBuffer::Unbind() const {
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        OpenGLRenderAPI::GetStateCache().BindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    void OpenGLVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+        WriteBufferStorage(m_RendererID, m_MappedData, m_Usage, offset, size, data);
     }
 
-    void OpenGLVertexBuffer::SetData(const void* data, uint32_t size) {
-        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+    void OpenGLVertexBuffer::GetData(void* data, uint32_t size, uint32_t offset) const {
+        if (m_Usage == BufferUsage::Readback)
+            std::memcpy(data, m_MappedData + offset, size);
+        else
+            glGetNamedBufferSubData(m_RendererID, offset, size, data);
     }
 
     // ===== Index Buffer =====
 
-    OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t* indices, uint32_t count)
-        : m_Count(count) {
-        glCreateBuffers(1, &m_RendererID);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+    OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t count, IndexType type, BufferUsage usage)
+        : m_Count(count), m_Type(type), m_Usage(usage) {
+        m_MappedData = CreateBufferStorage(m_RendererID, count * IndexTypeSize(type), nullptr, usage);
+    }
+
+    OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t* indices, uint32_t count, BufferUsage usage)
+        : m_Count(count), m_Usage(usage) {
+        m_MappedData = CreateBufferStorage(m_RendererID, count * sizeof(uint32_t), indices, usage);
     }
 
     OpenGLIndexBuffer::~OpenGLIndexBuffer() {
-        glDeleteBuffers(1, &m_RendererID);
+        DestroyBufferStorage(m_RendererID, m_MappedData);
+    }
+
+    void OpenGLIndexBuffer::SetData(const uint32_t* indices, uint32_t count, uint32_t offset) {
+        if (m_Type == IndexType::UInt16) {
+            std::vector<uint16_t> narrowed(indices, indices + count);
+            WriteBufferStorage(m_RendererID, m_MappedData, m_Usage, offset * sizeof(uint16_t), count * sizeof(uint16_t), narrowed.data());
+            return;
+        }
+        WriteBufferStorage(m_RendererID, m_MappedData, m_Usage, offset * sizeof(uint32_t), count * sizeof(uint32_t), indices);
     }
 
     void OpenGLIndexBuffer::Bind() const {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+        OpenGLRenderAPI::GetStateCache().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
     }
 
     void OpenGLIndexBuffer::Unbind() const {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        OpenGLRenderAPI::GetStateCache().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
 
 }
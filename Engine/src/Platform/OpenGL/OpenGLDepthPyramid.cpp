@@ -0,0 +1,172 @@
+#include "ClaudeEngine/Platform/OpenGL/OpenGLDepthPyramid.h"
+#include "ClaudeEngine/Platform/OpenGL/OpenGLRenderAPI.h"
+#include "ClaudeEngine/Renderer/RenderCommand.h"
+#include "ClaudeEngine/Core/Log.h"
+#include <glad/glad.h>
+#include <algorithm>
+
+namespace ClaudeEngine {
+
+    static uint32_t PreviousPowerOfTwo(uint32_t value) {
+        uint32_t result = 1;
+        while (result * 2 <= value)
+            result *= 2;
+        return result;
+    }
+
+    static bool IsSignaled(GLsync fence) {
+        GLenum result = glClientWaitSync(fence, 0, 0);
+        return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+    }
+
+    OpenGLDepthPyramid::OpenGLDepthPyramid() {
+        m_BuildShader = Shader::Create("assets/shaders/HiZBuild.glsl");
+        if (!m_BuildShader)
+            CE_CORE_ERROR("OpenGLDepthPyramid: Failed to load Hi-Z build shader");
+        m_SourceLevelHandle = Shader::GetUniformHandle("u_SourceLevel");
+    }
+
+    OpenGLDepthPyramid::~OpenGLDepthPyramid() {
+        ReleaseReadbacks();
+        if (m_RendererID) {
+            glDeleteTextures(1, &m_RendererID);
+            OpenGLRenderAPI::GetStateCache().OnTextureDeleted(m_RendererID);
+        }
+    }
+
+    void OpenGLDepthPyramid::Resize(uint32_t sourceWidth, uint32_t sourceHeight) {
+        if (m_RendererID && sourceWidth == m_SourceWidth && sourceHeight == m_SourceHeight)
+            return;
+
+        m_SourceWidth = sourceWidth;
+        m_SourceHeight = sourceHeight;
+        m_Width = PreviousPowerOfTwo(sourceWidth);
+        m_Height = PreviousPowerOfTwo(sourceHeight);
+        m_MipCount = 1;
+        while ((std::max(m_Width, m_Height) >> m_MipCount) > 0)
+            m_MipCount++;
+
+        if (m_RendererID) {
+            glDeleteTextures(1, &m_RendererID);
+            OpenGLRenderAPI::GetStateCache().OnTextureDeleted(m_RendererID);
+        }
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
+        glTextureStorage2D(m_RendererID, m_MipCount, GL_R32F, m_Width, m_Height);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        m_ReadbackLevel = 0;
+        while (std::max(m_Width >> m_ReadbackLevel, m_Height >> m_ReadbackLevel) > MaxReadbackSize)
+            m_ReadbackLevel++;
+        m_ReadbackWidth = std::max(m_Width >> m_ReadbackLevel, 1u);
+        m_ReadbackHeight = std::max(m_Height >> m_ReadbackLevel, 1u);
+
+        // Copies still in flight refer to the old size
+        ReleaseReadbacks();
+        const GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        GLsizeiptr totalSize = (GLsizeiptr)m_ReadbackWidth * m_ReadbackHeight * sizeof(float) * ReadbackSlots;
+        glCreateBuffers(1, &m_ReadbackBuffer);
+        glNamedBufferStorage(m_ReadbackBuffer, totalSize, nullptr, flags);
+        m_ReadbackMapped = (const float*)glMapNamedBufferRange(m_ReadbackBuffer, 0, totalSize, flags);
+        CE_CORE_ASSERT(m_ReadbackMapped, "Failed to persistently map Hi-Z readback buffer!");
+    }
+
+    void OpenGLDepthPyramid::ReleaseReadbacks() {
+        for (auto& slot : m_Slots) {
+            if (slot.Fence)
+                glDeleteSync(slot.Fence);
+            slot = ReadbackSlot();
+        }
+        m_NextSlot = 0;
+
+        if (m_ReadbackBuffer) {
+            glUnmapNamedBuffer(m_ReadbackBuffer);
+            glDeleteBuffers(1, &m_ReadbackBuffer);
+            OpenGLRenderAPI::GetStateCache().OnBufferDeleted(m_ReadbackBuffer);
+            m_ReadbackBuffer = 0;
+            m_ReadbackMapped = nullptr;
+        }
+    }
+
+    bool OpenGLDepthPyramid::Build(const Ref<Framebuffer>& framebuffer, const glm::mat4& viewProjection) {
+        const FramebufferSpecification& spec = framebuffer->GetSpecification();
+        uint32_t depthAttachment = framebuffer->GetDepthAttachmentRendererID();
+        // Multisampled depth would need a resolve first
+        if (!m_BuildShader || !depthAttachment || spec.Samples > 1 || spec.Width == 0 || spec.Height == 0)
+            return false;
+
+        Resize(spec.Width, spec.Height);
+
+        OpenGLStateCache& cache = OpenGLRenderAPI::GetStateCache();
+        m_BuildShader->Bind();
+        for (uint32_t level = 0; level < m_MipCount; level++) {
+            // Level 0 reduces the depth attachment, every other level the one above it
+            cache.BindTextureUnit(0, level == 0 ? depthAttachment : m_RendererID);
+            m_BuildShader->SetInt(m_SourceLevelHandle, level == 0 ? 0 : (int)level - 1);
+            cache.BindImageTexture(0, m_RendererID, level, GL_WRITE_ONLY, GL_R32F);
+
+            uint32_t width = std::max(m_Width >> level, 1u);
+            uint32_t height = std::max(m_Height >> level, 1u);
+            RenderCommand::DispatchCompute((width + 7) / 8, (height + 7) / 8, 1);
+            RenderCommand::InsertMemoryBarrier(RenderAPI::TextureFetchBarrier);
+        }
+
+        QueueReadback(viewProjection);
+        return true;
+    }
+
+    void OpenGLDepthPyramid::QueueReadback(const glm::mat4& viewProjection) {
+        ReadbackSlot& slot = m_Slots[m_NextSlot];
+        if (slot.Fence) {
+            // The GPU is more than a few frames behind; skip this copy rather than wait
+            if (!IsSignaled(slot.Fence))
+                return;
+            glDeleteSync(slot.Fence);
+            slot.Fence = nullptr;
+        }
+
+        GLsizei slotSize = (GLsizei)(m_ReadbackWidth * m_ReadbackHeight * sizeof(float));
+        uintptr_t offset = (uintptr_t)slotSize * m_NextSlot;
+
+        OpenGLStateCache& cache = OpenGLRenderAPI::GetStateCache();
+        RenderCommand::InsertMemoryBarrier(RenderAPI::TextureUpdateBarrier);
+        cache.BindBuffer(GL_PIXEL_PACK_BUFFER, m_ReadbackBuffer);
+        glGetTextureImage(m_RendererID, m_ReadbackLevel, GL_RED, GL_FLOAT, slotSize, (void*)offset);
+        // Client-memory readbacks such as Framebuffer::ReadPixel expect no pack buffer
+        cache.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        slot.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        slot.Sequence = m_NextSequence++;
+        slot.ViewProjection = viewProjection;
+        m_NextSlot = (m_NextSlot + 1) % ReadbackSlots;
+    }
+
+    bool OpenGLDepthPyramid::PollReadback(Readback& readback) {
+        int newest = -1;
+        for (uint32_t i = 0; i < ReadbackSlots; i++) {
+            const ReadbackSlot& slot = m_Slots[i];
+            if (!slot.Fence || slot.Sequence <= m_LastPolled)
+                continue;
+            if ((newest < 0 || slot.Sequence > m_Slots[newest].Sequence) && IsSignaled(slot.Fence))
+                newest = (int)i;
+        }
+        if (newest < 0)
+            return false;
+
+        const size_t texels = (size_t)m_ReadbackWidth * m_ReadbackHeight;
+        const float* source = m_ReadbackMapped + texels * newest;
+        readback.Depth.assign(source, source + texels);
+        readback.Width = m_ReadbackWidth;
+        readback.Height = m_ReadbackHeight;
+        readback.ViewProjection = m_Slots[newest].ViewProjection;
+        m_LastPolled = m_Slots[newest].Sequence;
+        return true;
+    }
+
+    void OpenGLDepthPyramid::Bind(uint32_t slot) const {
+        OpenGLRenderAPI::GetStateCache().BindTextureUnit(slot, m_RendererID);
+    }
+
+}
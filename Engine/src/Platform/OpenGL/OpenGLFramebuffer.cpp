@@ -1,6 +1,8 @@
 #include "ClaudeEngine/Platform/OpenGL/OpenGLFramebuffer.h"
+#include "ClaudeEngine/Platform/OpenGL/OpenGLRenderAPI.h"
 #include "ClaudeEngine/Core/Log.h"
 #include <glad/glad.h>
+#include <algorithm>
 
 namespace ClaudeEngine {
 
@@ -88,23 +90,29 @@ namespace ClaudeEngine {
     }
 
     OpenGLFramebuffer::~OpenGLFramebuffer() {
-        glDeleteFramebuffers(1, &m_RendererID);
-        glDeleteTextures(m_ColorAttachments.size(), m_ColorAttachments.data());
-        glDeleteTextures(1, &m_DepthAttachment);
+        Release();
+
+        for (PendingReadback& pending : m_PendingReadbacks) {
+            glDeleteSync(pending.Fence);
+            m_FreeReadbackBuffers.push_back(pending.Buffer);
+        }
+        for (const ReadbackBuffer& buffer : m_FreeReadbackBuffers) {
+            glDeleteBuffers(1, &buffer.RendererID);
+            OpenGLRenderAPI::GetStateCache().OnBufferDeleted(buffer.RendererID);
+        }
     }
 
     void OpenGLFramebuffer::Invalidate() {
         if (m_RendererID) {
-            glDeleteFramebuffers(1, &m_RendererID);
-            glDeleteTextures(m_ColorAttachments.size(), m_ColorAttachments.data());
-            glDeleteTextures(1, &m_DepthAttachment);
+            Release();
 
             m_ColorAttachments.clear();
             m_DepthAttachment = 0;
         }
 
+        OpenGLStateCache& cache = OpenGLRenderAPI::GetStateCache();
         glCreateFramebuffers(1, &m_RendererID);
-        glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+        cache.BindFramebuffer(m_RendererID);
 
         bool multisample = m_Specification.Samples > 1;
 
@@ -147,16 +155,31 @@ namespace ClaudeEngine {
 
         CE_CORE_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is incomplete!");
 
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        // Attachments were set up with glBindTexture on whatever unit was active
+        cache.InvalidateTextureUnits();
+        cache.BindFramebuffer(0);
+    }
+
+    void OpenGLFramebuffer::Release() {
+        OpenGLStateCache& cache = OpenGLRenderAPI::GetStateCache();
+        glDeleteFramebuffers(1, &m_RendererID);
+        cache.OnFramebufferDeleted(m_RendererID);
+
+        glDeleteTextures(m_ColorAttachments.size(), m_ColorAttachments.data());
+        for (uint32_t attachment : m_ColorAttachments)
+            cache.OnTextureDeleted(attachment);
+        glDeleteTextures(1, &m_DepthAttachment);
+        cache.OnTextureDeleted(m_DepthAttachment);
     }
 
     void OpenGLFramebuffer::Bind() {
-        glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
-        glViewport(0, 0, m_Specification.Width, m_Specification.Height);
+        OpenGLStateCache& cache = OpenGLRenderAPI::GetStateCache();
+        cache.BindFramebuffer(m_RendererID);
+        cache.SetViewport(0, 0, m_Specification.Width, m_Specification.Height);
     }
 
     void OpenGLFramebuffer::Unbind() {
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        OpenGLRenderAPI::GetStateCache().BindFramebuffer(0);
     }
 
     void OpenGLFramebuffer::Resize(uint32_t width, uint32_t height) {
@@ -179,6 +202,96 @@ namespace ClaudeEngine {
         return pixelData;
     }
 
+    OpenGLFramebuffer::ReadbackBuffer OpenGLFramebuffer::AcquireReadbackBuffer(uint32_t size) {
+        // Smallest free buffer that fits; otherwise the most recently freed one is replaced by a larger one
+        int best = -1;
+        for (int i = 0; i < (int)m_FreeReadbackBuffers.size(); i++) {
+            uint32_t capacity = m_FreeReadbackBuffers[i].Capacity;
+            if (capacity >= size && (best < 0 || capacity < m_FreeReadbackBuffers[best].Capacity))
+                best = i;
+        }
+
+        ReadbackBuffer buffer;
+        if (best >= 0) {
+            buffer = m_FreeReadbackBuffers[best];
+            m_FreeReadbackBuffers.erase(m_FreeReadbackBuffers.begin() + best);
+            return buffer;
+        }
+
+        if (!m_FreeReadbackBuffers.empty()) {
+            buffer = m_FreeReadbackBuffers.back();
+            m_FreeReadbackBuffers.pop_back();
+            glDeleteBuffers(1, &buffer.RendererID);
+            OpenGLRenderAPI::GetStateCache().OnBufferDeleted(buffer.RendererID);
+        }
+        buffer.Capacity = size;
+        glCreateBuffers(1, &buffer.RendererID);
+        glNamedBufferStorage(buffer.RendererID, size, nullptr, GL_MAP_READ_BIT);
+        return buffer;
+    }
+
+    void OpenGLFramebuffer::ReadPixelsAsync(uint32_t attachmentIndex, int x, int y, uint32_t width, uint32_t height,
+                                            PixelReadbackCallback callback) {
+        CE_CORE_ASSERT(attachmentIndex < m_ColorAttachments.size(), "Attachment index out of bounds");
+        CE_CORE_ASSERT(m_ColorAttachmentSpecifications[attachmentIndex].TextureFormat == FramebufferTextureFormat::RED_INTEGER,
+                       "Asynchronous reads need an integer attachment");
+        if (m_Specification.Samples > 1) {
+            CE_CORE_WARN("OpenGLFramebuffer: Cannot read back a multisampled attachment");
+            return;
+        }
+
+        int x0 = std::max(x, 0);
+        int y0 = std::max(y, 0);
+        int x1 = std::min(x + (int)width, (int)m_Specification.Width);
+        int y1 = std::min(y + (int)height, (int)m_Specification.Height);
+        if (x0 >= x1 || y0 >= y1)
+            return;
+
+        PendingReadback pending;
+        pending.Region.X = x0;
+        pending.Region.Y = y0;
+        pending.Region.Width = (uint32_t)(x1 - x0);
+        pending.Region.Height = (uint32_t)(y1 - y0);
+        pending.Callback = std::move(callback);
+
+        const uint32_t size = pending.Region.Width * pending.Region.Height * sizeof(int);
+        pending.Buffer = AcquireReadbackBuffer(size);
+
+        // Reads the attachment texture directly, so the current framebuffer bindings stay as they are
+        OpenGLStateCache& cache = OpenGLRenderAPI::GetStateCache();
+        cache.BindBuffer(GL_PIXEL_PACK_BUFFER, pending.Buffer.RendererID);
+        glGetTextureSubImage(m_ColorAttachments[attachmentIndex], 0, x0, y0, 0, x1 - x0, y1 - y0, 1,
+                             GL_RED_INTEGER, GL_INT, (GLsizei)size, nullptr);
+        // Client-memory readbacks such as ReadPixel expect no pack buffer
+        cache.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        pending.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        m_PendingReadbacks.push_back(std::move(pending));
+    }
+
+    void OpenGLFramebuffer::PollReadbacks() {
+        // Fences signal in submission order, so the first unfinished read ends the scan
+        while (!m_PendingReadbacks.empty()) {
+            PendingReadback& pending = m_PendingReadbacks.front();
+            // Flushing makes sure the fence reaches the GPU even if nothing else flushes before the next poll
+            GLenum status = glClientWaitSync(pending.Fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+                break;
+            glDeleteSync(pending.Fence);
+
+            PixelReadback& region = pending.Region;
+            region.Values.resize((size_t)region.Width * region.Height);
+            glGetNamedBufferSubData(pending.Buffer.RendererID, 0, region.Values.size() * sizeof(int), region.Values.data());
+            m_FreeReadbackBuffers.push_back(pending.Buffer);
+
+            // Callbacks may queue new reads, which go to the back
+            PendingReadback finished = std::move(pending);
+            m_PendingReadbacks.pop_front();
+            if (finished.Callback)
+                finished.Callback(finished.Region);
+        }
+    }
+
     void OpenGLFramebuffer::ClearAttachment(uint32_t attachmentIndex, int value) {
         CE_CORE_ASSERT(attachmentIndex < m_ColorAttachments.size(), "Attachment index out of bounds");
 
@@ -0,0 +1,202 @@
+#include "ClaudeEngine/Platform/OpenGL/OpenGLProgramCache.h"
+#include "ClaudeEngine/Core/Log.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace ClaudeEngine {
+
+    namespace {
+
+        constexpr uint32_t CacheMagic = 0x50474543; // "CEGP"
+        constexpr uint32_t CacheVersion = 1;
+
+        struct CacheHeader {
+            uint32_t Magic;
+            uint32_t Version;
+            uint64_t SourceHash;
+            uint64_t DriverHash;
+            uint32_t Format;
+            uint32_t Size;
+        };
+
+        struct ProgramCacheData {
+            std::string Directory = "cache/shaders";
+            bool Enabled = true;
+            bool Probed = false;
+            bool Supported = false;
+            uint64_t DriverHash = 0;
+            OpenGLProgramCache::Statistics Stats;
+        };
+
+    }
+
+    static ProgramCacheData s_CacheData;
+
+    // FNV-1a
+    static uint64_t HashBytes(const void* data, size_t size, uint64_t hash = 14695981039346656037ull) {
+        const uint8_t* bytes = (const uint8_t*)data;
+        for (size_t i = 0; i < size; i++) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    static bool IsCacheUsable() {
+        if (!s_CacheData.Probed) {
+            s_CacheData.Probed = true;
+
+            GLint formats = 0;
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+            s_CacheData.Supported = formats > 0;
+            if (!s_CacheData.Supported)
+                CE_CORE_WARN("Program binary cache disabled: the driver offers no binary formats");
+
+            // Binaries are only valid for the driver build that produced them
+            uint64_t hash = HashBytes(nullptr, 0);
+            for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+                const char* value = (const char*)glGetString(name);
+                if (value)
+                    hash = HashBytes(value, strlen(value) + 1, hash);
+            }
+            s_CacheData.DriverHash = hash;
+        }
+        return s_CacheData.Enabled && s_CacheData.Supported;
+    }
+
+    static std::filesystem::path GetEntryPath(uint64_t key) {
+        char name[32];
+        snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+        return std::filesystem::path(s_CacheData.Directory) / name;
+    }
+
+    static void RejectEntry(const std::filesystem::path& path, const char* reason) {
+        CE_CORE_WARN("Discarding cached program ", path.string(), ": ", reason);
+        s_CacheData.Stats.Rejected++;
+        std::error_code error;
+        std::filesystem::remove(path, error);
+    }
+
+    void OpenGLProgramCache::SetDirectory(const std::string& directory) {
+        s_CacheData.Directory = directory;
+    }
+
+    void OpenGLProgramCache::SetEnabled(bool enabled) {
+        s_CacheData.Enabled = enabled;
+    }
+
+    uint64_t OpenGLProgramCache::ComputeKey(const std::unordered_map<GLenum, std::string>& shaderSources) {
+        // Map order is unspecified; the key must not depend on it
+        std::vector<std::pair<GLenum, const std::string*>> stages;
+        for (auto& kv : shaderSources)
+            stages.emplace_back(kv.first, &kv.second);
+        std::sort(stages.begin(), stages.end());
+
+        uint64_t hash = HashBytes(nullptr, 0);
+        for (auto& stage : stages) {
+            hash = HashBytes(&stage.first, sizeof(stage.first), hash);
+            hash = HashBytes(stage.second->data(), stage.second->size(), hash);
+        }
+        return hash;
+    }
+
+    uint32_t OpenGLProgramCache::Load(uint64_t key) {
+        if (!IsCacheUsable())
+            return 0;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        const std::filesystem::path path = GetEntryPath(key);
+        std::ifstream in(path, std::ios::in | std::ios::binary);
+        if (!in) {
+            s_CacheData.Stats.Misses++;
+            return 0;
+        }
+
+        CacheHeader header = {};
+        in.read((char*)&header, sizeof(header));
+        if (!in || header.Magic != CacheMagic || header.Version != CacheVersion || header.SourceHash != key || header.Size == 0) {
+            in.close();
+            RejectEntry(path, "bad header");
+            return 0;
+        }
+        if (header.DriverHash != s_CacheData.DriverHash) {
+            in.close();
+            RejectEntry(path, "built by a different driver");
+            return 0;
+        }
+
+        std::vector<char> binary(header.Size);
+        in.read(binary.data(), header.Size);
+        if (!in) {
+            in.close();
+            RejectEntry(path, "truncated");
+            return 0;
+        }
+        in.close();
+
+        GLuint program = glCreateProgram();
+        glProgramBinary(program, header.Format, binary.data(), (GLsizei)header.Size);
+        GLint isLinked = 0;
+        glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+        if (isLinked == GL_FALSE) {
+            glDeleteProgram(program);
+            RejectEntry(path, "refused by the driver");
+            return 0;
+        }
+
+        s_CacheData.Stats.Hits++;
+        s_CacheData.Stats.LoadMs += std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        return program;
+    }
+
+    void OpenGLProgramCache::Store(uint64_t key, uint32_t program) {
+        if (!IsCacheUsable())
+            return;
+
+        GLint length = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0)
+            return;
+
+        std::vector<char> binary(length);
+        GLenum format = 0;
+        glGetProgramBinary(program, length, &length, &format, binary.data());
+
+        std::error_code error;
+        std::filesystem::create_directories(s_CacheData.Directory, error);
+        if (error) {
+            CE_CORE_WARN("Could not create program cache directory '", s_CacheData.Directory, "': ", error.message());
+            return;
+        }
+
+        CacheHeader header = { CacheMagic, CacheVersion, key, s_CacheData.DriverHash, format, (uint32_t)length };
+
+        // Written aside and renamed into place, so an interrupted write never leaves a half entry
+        const std::filesystem::path path = GetEntryPath(key);
+        std::filesystem::path staging = path;
+        staging += ".tmp";
+        {
+            std::ofstream out(staging, std::ios::out | std::ios::binary | std::ios::trunc);
+            out.write((const char*)&header, sizeof(header));
+            out.write(binary.data(), length);
+            if (!out) {
+                CE_CORE_WARN("Could not write program cache entry '", staging.string(), "'");
+                return;
+            }
+        }
+        std::filesystem::rename(staging, path, error);
+        if (error)
+            CE_CORE_WARN("Could not store program cache entry '", path.string(), "': ", error.message());
+    }
+
+    const OpenGLProgramCache::Statistics& OpenGLProgramCache::GetStats() {
+        return s_CacheData.Stats;
+    }
+
+}
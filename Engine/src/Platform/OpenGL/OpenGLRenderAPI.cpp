@@ -1,32 +1,145 @@
 #include "ClaudeEngine/Platform/OpenGL/OpenGLRenderAPI.h"
 #include "ClaudeEngine/Renderer/VertexArray.h"
+#include "ClaudeEngine/Renderer/StorageBuffer.h"
 #include <glad/glad.h>
 
 namespace ClaudeEngine {
 
+    OpenGLStateCache& OpenGLRenderAPI::GetStateCache() {
+        static OpenGLStateCache cache;
+        return cache;
+    }
+
     void OpenGLRenderAPI::Init() {
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        OpenGLStateCache& cache = GetStateCache();
+        cache.Invalidate();
+
+        cache.SetEnabled(GL_BLEND, true);
+        cache.SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+        cache.SetEnabled(GL_DEPTH_TEST, true);
+        cache.SetEnabled(GL_LINE_SMOOTH, true);
+        // Geometry already in a depth pre-pass must still pass the main pass at equal depth
+        cache.SetDepthFunc(GL_LEQUAL);
+
+        m_Capabilities.ComputeShaders = GLAD_GL_VERSION_4_3 != 0;
+        m_Capabilities.IndirectCount = GLAD_GL_VERSION_4_6 != 0 || GLAD_GL_ARB_indirect_parameters != 0;
 
-        glEnable(GL_DEPTH_TEST);
-        glEnable(GL_LINE_SMOOTH);
+        // Let the driver use as many compiler threads as it likes for Shader::CreateAsync
+        if (GLAD_GL_KHR_parallel_shader_compile)
+            glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+        else if (GLAD_GL_ARB_parallel_shader_compile)
+            glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
     }
 
     void OpenGLRenderAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
-        glViewport(x, y, width, height);
+        GetStateCache().SetViewport(x, y, width, height);
     }
 
     void OpenGLRenderAPI::SetClearColor(const glm::vec4& color) {
-        glClearColor(color.r, color.g, color.b, color.a);
+        GetStateCache().SetClearColor(color);
     }
 
     void OpenGLRenderAPI::Clear() {
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     }
 
-    void OpenGLRenderAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount) {
+    void OpenGLRenderAPI::SetBlend(bool enabled) {
+        OpenGLStateCache& cache = GetStateCache();
+        cache.SetEnabled(GL_BLEND, enabled);
+        if (enabled)
+            cache.SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    }
+
+    void OpenGLRenderAPI::SetDepthTest(bool enabled) {
+        GetStateCache().SetEnabled(GL_DEPTH_TEST, enabled);
+    }
+
+    void OpenGLRenderAPI::SetDepthWrite(bool enabled) {
+        GetStateCache().SetDepthMask(enabled);
+    }
+
+    void OpenGLRenderAPI::SetColorWrite(bool enabled) {
+        GetStateCache().SetColorMask(enabled);
+    }
+
+    void OpenGLRenderAPI::SetFaceCulling(bool enabled) {
+        GetStateCache().SetEnabled(GL_CULL_FACE, enabled);
+    }
+
+    static GLenum GetElementType(const Ref<VertexArray>& vertexArray) {
+        return vertexArray->GetIndexBuffer()->GetIndexType() == IndexType::UInt16 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    }
+
+    void OpenGLRenderAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t firstIndex, int32_t baseVertex) {
+        const Ref<IndexBuffer>& indexBuffer = vertexArray->GetIndexBuffer();
+        uint32_t count = indexCount ? indexCount : indexBuffer->GetCount();
+        const void* offset = (const void*)((uintptr_t)firstIndex * IndexTypeSize(indexBuffer->GetIndexType()));
+        glDrawElementsBaseVertex(GL_TRIANGLES, count, GetElementType(vertexArray), offset, baseVertex);
+    }
+
+    void OpenGLRenderAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount, uint32_t baseInstance) {
         uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
-        glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+        glDrawElementsInstancedBaseInstance(GL_TRIANGLES, count, GetElementType(vertexArray), nullptr, instanceCount, baseInstance);
+    }
+
+    void OpenGLRenderAPI::DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t firstCommand, uint32_t drawCount) {
+        GetStateCache().BindBuffer(GL_DRAW_INDIRECT_BUFFER, commands->GetRendererID());
+        uintptr_t offset = commands->GetAllocationOffset() + (uintptr_t)firstCommand * sizeof(DrawIndexedIndirectCommand);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GetElementType(vertexArray), (const void*)offset, drawCount, 0);
+    }
+
+    void OpenGLRenderAPI::DrawIndexedIndirectCount(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t firstCommand,
+                                                   const Ref<StorageBuffer>& counts, uint32_t countOffset, uint32_t maxDrawCount) {
+        OpenGLStateCache& cache = GetStateCache();
+        cache.BindBuffer(GL_DRAW_INDIRECT_BUFFER, commands->GetRendererID());
+        cache.BindBuffer(GL_PARAMETER_BUFFER, counts->GetRendererID());
+
+        uintptr_t offset = commands->GetAllocationOffset() + (uintptr_t)firstCommand * sizeof(DrawIndexedIndirectCommand);
+        GLintptr drawCountOffset = counts->GetAllocationOffset() + countOffset;
+        GLenum elementType = GetElementType(vertexArray);
+        if (GLAD_GL_VERSION_4_6)
+            glMultiDrawElementsIndirectCount(GL_TRIANGLES, elementType, (const void*)offset, drawCountOffset, maxDrawCount, 0);
+        else
+            glMultiDrawElementsIndirectCountARB(GL_TRIANGLES, elementType, (const void*)offset, drawCountOffset, maxDrawCount, 0);
+    }
+
+    void OpenGLRenderAPI::DispatchCompute(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) {
+        glDispatchCompute(groupsX, groupsY, groupsZ);
+    }
+
+    void OpenGLRenderAPI::InsertMemoryBarrier(uint32_t barriers) {
+        GLbitfield bits = 0;
+        if (barriers & StorageBarrier)
+            bits |= GL_SHADER_STORAGE_BARRIER_BIT;
+        if (barriers & IndirectCommandBarrier)
+            bits |= GL_COMMAND_BARRIER_BIT;
+        if (barriers & ReadbackBarrier)
+            bits |= GL_BUFFER_UPDATE_BARRIER_BIT;
+        if (barriers & ClientMappedBarrier)
+            bits |= GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT;
+        if (barriers & TextureFetchBarrier)
+            bits |= GL_TEXTURE_FETCH_BARRIER_BIT;
+        if (barriers & TextureUpdateBarrier)
+            bits |= GL_TEXTURE_UPDATE_BARRIER_BIT;
+        if (bits)
+            glMemoryBarrier(bits);
+    }
+
+    RenderAPI::StateStatistics OpenGLRenderAPI::GetStateStatistics() const {
+        const OpenGLStateCache::Counters& counters = GetStateCache().GetCounters();
+        StateStatistics stats;
+        stats.IssuedCalls = counters.Issued;
+        stats.FilteredCalls = counters.Filtered;
+        return stats;
+    }
+
+    void OpenGLRenderAPI::ResetStateStatistics() {
+        GetStateCache().ResetCounters();
+    }
+
+    void OpenGLRenderAPI::InvalidateStateCache() {
+        GetStateCache().Invalidate();
     }
 
 }
@@ -1,10 +1,13 @@
 #include "ClaudeEngine/Platform/OpenGL/OpenGLShader.h"
+#include "ClaudeEngine/Platform/OpenGL/OpenGLRenderAPI.h"
+#include "ClaudeEngine/Platform/OpenGL/OpenGLProgramCache.h"
 #include "ClaudeEngine/Core/Log.h"
 #include <glad/glad.h>
 #include <glm/gtc/type_ptr.hpp>
 #include <fstream>
 #include <sstream>
-#include <array>
+#include <cstring>
+#include <algorithm>
 
 namespace ClaudeEngine {
 
@@ -13,22 +16,38 @@ namespace ClaudeEngine {
             return GL_VERTEX_SHADER;
         if (type == "fragment" || type == "pixel")
             return GL_FRAGMENT_SHADER;
+        if (type == "compute")
+            return GL_COMPUTE_SHADER;
 
         CE_CORE_ASSERT(false, "Unknown shader type!");
         return 0;
     }
 
-    OpenGLShader::OpenGLShader(const std::string& filepath) {
-        std::string source = ReadFile(filepath);
-        auto shaderSources = PreProcess(source);
-        Compile(shaderSources);
+    static bool HasParallelCompile() {
+        return GLAD_GL_KHR_parallel_shader_compile || GLAD_GL_ARB_parallel_shader_compile;
+    }
 
+    OpenGLShader::OpenGLShader(const std::string& filepath, bool async) {
         // Extract name from filepath
         auto lastSlash = filepath.find_last_of("/\\");
         lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
         auto lastDot = filepath.rfind('.');
         auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
         m_Name = filepath.substr(lastSlash, count);
+
+        std::string source = ReadFile(filepath);
+        auto shaderSources = PreProcess(source);
+        m_Features = ParseFeatures(source);
+        if (!m_Features.empty())
+            m_VariantSources = shaderSources;
+
+        // The shader itself is the variant with no keywords defined
+        BeginCompile(shaderSources);
+        if (async)
+            return;
+
+        FinishCompile();
+        CE_CORE_ASSERT(m_Status == ShaderStatus::Ready, "Shader build failure!");
     }
 
     OpenGLShader::OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
@@ -36,11 +55,19 @@ namespace ClaudeEngine {
         std::unordered_map<GLenum, std::string> sources;
         sources[GL_VERTEX_SHADER] = vertexSrc;
         sources[GL_FRAGMENT_SHADER] = fragmentSrc;
-        Compile(sources);
+        BeginCompile(sources);
+        FinishCompile();
+        CE_CORE_ASSERT(m_Status == ShaderStatus::Ready, "Shader build failure!");
+    }
+
+    OpenGLShader::OpenGLShader(const std::string& name, const std::unordered_map<GLenum, std::string>& shaderSources)
+        : m_Name(name) {
+        BeginCompile(shaderSources);
     }
 
     OpenGLShader::~OpenGLShader() {
         glDeleteProgram(m_RendererID);
+        OpenGLRenderAPI::GetStateCache().OnProgramDeleted(m_RendererID);
     }
 
     std::string OpenGLShader::ReadFile(const std::string& filepath) {
@@ -87,76 +114,237 @@ namespace ClaudeEngine {
         return shaderSources;
     }
 
-    void OpenGLShader::Compile(const std::unordered_map<GLenum, std::string>& shaderSources) {
-        GLuint program = glCreateProgram();
-        CE_CORE_ASSERT(shaderSources.size() <= 2, "Only 2 shaders are supported for now");
-        std::array<GLenum, 2> glShaderIDs;
-        int glShaderIDIndex = 0;
+    std::vector<std::string> OpenGLShader::ParseFeatures(const std::string& source) {
+        std::vector<std::string> features;
 
-        for (auto& kv : shaderSources) {
-            GLenum type = kv.first;
-            const std::string& source = kv.second;
+        // GLSL ignores unknown pragmas, and the line usually sits above the first #type anyway
+        const char* featuresToken = "#pragma features";
+        size_t pos = source.find(featuresToken, 0);
+        while (pos != std::string::npos) {
+            size_t begin = pos + strlen(featuresToken);
+            size_t eol = source.find_first_of("\r\n", begin);
+            std::istringstream line(source.substr(begin, eol == std::string::npos ? std::string::npos : eol - begin));
+            std::string feature;
+            while (line >> feature) {
+                if (std::find(features.begin(), features.end(), feature) == features.end())
+                    features.push_back(feature);
+            }
+            pos = source.find(featuresToken, begin);
+        }
+
+        CE_CORE_ASSERT(features.size() <= 32, "A shader can declare at most 32 features");
+        return features;
+    }
+
+    // Defines must follow #version, which has to stay the first statement of a stage
+    static std::string InjectDefines(const std::string& source, const std::string& defines) {
+        size_t version = source.find("#version");
+        if (version == std::string::npos)
+            return defines + source;
+
+        size_t eol = source.find_first_of("\r\n", version);
+        if (eol == std::string::npos)
+            return source + "\n" + defines;
+        eol = source.find_first_not_of("\r\n", eol);
+        if (eol == std::string::npos)
+            return source + defines;
+        return source.substr(0, eol) + defines + source.substr(eol);
+    }
 
-            GLuint shader = glCreateShader(type);
-            const GLchar* sourceCStr = source.c_str();
+    Shader* OpenGLShader::GetVariant(ShaderFeatureMask features) {
+        // Undeclared bits would only produce duplicate programs
+        if (m_Features.size() < 32)
+            features &= (1u << m_Features.size()) - 1;
+        if (features == 0)
+            return this;
+
+        auto it = m_Variants.find(features);
+        if (it != m_Variants.end())
+            return it->second.get();
+
+        std::string name = m_Name + "[";
+        std::string defines;
+        for (size_t i = 0; i < m_Features.size(); i++) {
+            if ((features & (1u << i)) == 0)
+                continue;
+            if (name.back() != '[')
+                name += ",";
+            name += m_Features[i];
+            defines += "#define " + m_Features[i] + " 1\n";
+        }
+        name += "]";
+
+        // The program cache keys on the final sources, so every permutation gets its own entry
+        std::unordered_map<GLenum, std::string> shaderSources;
+        for (auto& kv : m_VariantSources)
+            shaderSources[kv.first] = InjectDefines(kv.second, defines);
+
+        OpenGLShader* variant = new OpenGLShader(name, shaderSources);
+        m_Variants.emplace(features, Scope<OpenGLShader>(variant));
+        return variant;
+    }
+
+    void OpenGLShader::BeginCompile(const std::unordered_map<GLenum, std::string>& shaderSources) {
+        m_CompileStart = std::chrono::high_resolution_clock::now();
+
+        // Unchanged sources on the same driver skip compiling and linking altogether
+        m_CacheKey = OpenGLProgramCache::ComputeKey(shaderSources);
+        if (GLuint cached = OpenGLProgramCache::Load(m_CacheKey)) {
+            m_RendererID = cached;
+            m_Status = ShaderStatus::Ready;
+            ReflectUniforms();
+            CE_CORE_INFO("Shader '", m_Name, "' loaded from the program cache");
+            return;
+        }
+
+        CE_CORE_ASSERT(shaderSources.size() <= 2, "Only 2 shaders are supported for now");
+        GLuint program = glCreateProgram();
+        for (auto& kv : shaderSources) {
+            GLuint shader = glCreateShader(kv.first);
+            const GLchar* sourceCStr = kv.second.c_str();
             glShaderSource(shader, 1, &sourceCStr, 0);
             glCompileShader(shader);
+            glAttachShader(program, shader);
+            m_PendingShaders.push_back(shader);
+        }
+
+        // Compile errors surface as a link failure, so linking need not wait for them. With
+        // parallel compile support none of these calls block; only status queries do.
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        glLinkProgram(program);
+
+        m_RendererID = program;
+        m_Status = ShaderStatus::Compiling;
+    }
+
+    void OpenGLShader::FinishCompile() {
+        const GLuint program = m_RendererID;
 
+        bool compiled = true;
+        for (GLuint shader : m_PendingShaders) {
             GLint isCompiled = 0;
             glGetShaderiv(shader, GL_COMPILE_STATUS, &isCompiled);
             if (isCompiled == GL_FALSE) {
                 GLint maxLength = 0;
                 glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
 
-                std::vector<GLchar> infoLog(maxLength);
+                std::vector<GLchar> infoLog(std::max(maxLength, 1), '\0');
                 glGetShaderInfoLog(shader, maxLength, &maxLength, &infoLog[0]);
+                CE_CORE_ERROR("Shader '", m_Name, "' failed to compile: ", infoLog.data());
+                compiled = false;
+            }
+        }
 
-                glDeleteShader(shader);
+        GLint isLinked = GL_FALSE;
+        if (compiled) {
+            glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+            if (isLinked == GL_FALSE) {
+                GLint maxLength = 0;
+                glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
 
-                CE_CORE_ERROR(infoLog.data());
-                CE_CORE_ASSERT(false, "Shader compilation failure!");
-                break;
+                std::vector<GLchar> infoLog(std::max(maxLength, 1), '\0');
+                glGetProgramInfoLog(program, maxLength, &maxLength, &infoLog[0]);
+                CE_CORE_ERROR("Shader '", m_Name, "' failed to link: ", infoLog.data());
             }
-
-            glAttachShader(program, shader);
-            glShaderIDs[glShaderIDIndex++] = shader;
         }
 
-        m_RendererID = program;
-
-        glLinkProgram(program);
+        for (GLuint shader : m_PendingShaders) {
+            glDetachShader(program, shader);
+            glDeleteShader(shader);
+        }
+        m_PendingShaders.clear();
 
-        GLint isLinked = 0;
-        glGetProgramiv(program, GL_LINK_STATUS, (int*)&isLinked);
+        // A failed program stays allocated so the destructor has one thing to clean up
         if (isLinked == GL_FALSE) {
-            GLint maxLength = 0;
-            glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+            m_Status = ShaderStatus::Failed;
+            return;
+        }
 
-            std::vector<GLchar> infoLog(maxLength);
-            glGetProgramInfoLog(program, maxLength, &maxLength, &infoLog[0]);
+        OpenGLProgramCache::Store(m_CacheKey, program);
+        ReflectUniforms();
+        m_Status = ShaderStatus::Ready;
 
-            glDeleteProgram(program);
+        float elapsed = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - m_CompileStart).count();
+        CE_CORE_INFO("Shader '", m_Name, "' compiled in ", elapsed, " ms");
+    }
 
-            for (auto id : glShaderIDs)
-                glDeleteShader(id);
+    ShaderStatus OpenGLShader::GetStatus() {
+        if (m_Status != ShaderStatus::Compiling)
+            return m_Status;
 
-            CE_CORE_ERROR(infoLog.data());
-            CE_CORE_ASSERT(false, "Shader link failure!");
-            return;
+        // Without the extension there is no way to ask, so this finishes (and may wait) right away
+        if (HasParallelCompile()) {
+            GLint done = GL_FALSE;
+            glGetProgramiv(m_RendererID, GL_COMPLETION_STATUS_KHR, &done);
+            if (done == GL_FALSE)
+                return m_Status;
         }
 
-        for (auto id : glShaderIDs) {
-            glDetachShader(program, id);
-            glDeleteShader(id);
+        FinishCompile();
+        return m_Status;
+    }
+
+    void OpenGLShader::ReflectUniforms() {
+        m_UniformLocations.clear();
+        m_HandleLocations.clear();
+
+        GLint uniformCount = 0;
+        glGetProgramInterfaceiv(m_RendererID, GL_UNIFORM, GL_ACTIVE_RESOURCES, &uniformCount);
+
+        const GLenum properties[] = { GL_NAME_LENGTH, GL_LOCATION, GL_ARRAY_SIZE };
+        GLint values[3];
+        std::string name;
+        for (GLint i = 0; i < uniformCount; i++) {
+            glGetProgramResourceiv(m_RendererID, GL_UNIFORM, i, 3, properties, 3, nullptr, values);
+
+            // Uniform block members have no location
+            if (values[1] == -1)
+                continue;
+
+            name.resize(values[0]);
+            glGetProgramResourceName(m_RendererID, GL_UNIFORM, i, values[0], nullptr, &name[0]);
+            name.resize(values[0] - 1); // Drop the null terminator
+
+            m_UniformLocations[name] = values[1];
+
+            // Arrays are reported as "name[0]"; also register the bare name and each element
+            if (values[2] > 1 || name.back() == ']') {
+                size_t bracket = name.rfind('[');
+                if (bracket != std::string::npos) {
+                    std::string base = name.substr(0, bracket);
+                    m_UniformLocations[base] = values[1];
+                    for (GLint element = 1; element < values[2]; element++)
+                        m_UniformLocations[base + "[" + std::to_string(element) + "]"] = values[1] + element;
+                }
+            }
         }
     }
 
+    int OpenGLShader::GetUniformLocation(const std::string& name) {
+        auto it = m_UniformLocations.find(name);
+        if (it != m_UniformLocations.end())
+            return it->second;
+
+        // Not active in this program (or a name reflection did not produce); cache the answer
+        GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+        m_UniformLocations.emplace(name, location);
+        return location;
+    }
+
+    int OpenGLShader::ResolveHandle(UniformHandle handle) {
+        if (handle >= m_HandleLocations.size())
+            m_HandleLocations.resize(handle + 1, UnresolvedLocation);
+
+        m_HandleLocations[handle] = GetUniformLocation(Shader::GetUniformName(handle));
+        return m_HandleLocations[handle];
+    }
+
     void OpenGLShader::Bind() const {
-        glUseProgram(m_RendererID);
+        OpenGLRenderAPI::GetStateCache().UseProgram(m_RendererID);
     }
 
     void OpenGLShader::Unbind() const {
-        glUseProgram(0);
+        OpenGLRenderAPI::GetStateCache().UseProgram(0);
     }
 
     void OpenGLShader::SetInt(const std::string& name, int value) {
@@ -187,43 +375,67 @@ namespace ClaudeEngine {
         UploadUniformMat4(name, value);
     }
 
+    void OpenGLShader::SetInt(UniformHandle handle, int value) {
+        glUniform1i(GetUniformLocation(handle), value);
+    }
+
+    void OpenGLShader::SetFloat(UniformHandle handle, float value) {
+        glUniform1f(GetUniformLocation(handle), value);
+    }
+
+    void OpenGLShader::SetFloat2(UniformHandle handle, const glm::vec2& value) {
+        glUniform2f(GetUniformLocation(handle), value.x, value.y);
+    }
+
+    void OpenGLShader::SetFloat3(UniformHandle handle, const glm::vec3& value) {
+        glUniform3f(GetUniformLocation(handle), value.x, value.y, value.z);
+    }
+
+    void OpenGLShader::SetFloat4(UniformHandle handle, const glm::vec4& value) {
+        glUniform4f(GetUniformLocation(handle), value.x, value.y, value.z, value.w);
+    }
+
+    void OpenGLShader::SetMat4(UniformHandle handle, const glm::mat4& value) {
+        glUniformMatrix4fv(GetUniformLocation(handle), 1, GL_FALSE, glm::value_ptr(value));
+    }
+
     void OpenGLShader::UploadUniformInt(const std::string& name, int value) {
-        GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint location = GetUniformLocation(name);
         glUniform1i(location, value);
     }
 
     void OpenGLShader::UploadUniformIntArray(const std::string& name, int* values, uint32_t count) {
-        GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint location = GetUniformLocation(name);
         glUniform1iv(location, count, values);
     }
 
     void OpenGLShader::UploadUniformFloat(const std::string& name, float value) {
-        GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint location = GetUniformLocation(name);
         glUniform1f(location, value);
     }
 
     void OpenGLShader::UploadUniformFloat2(const std::string& name, const glm::vec2& value) {
-        GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint location = GetUniformLocation(name);
         glUniform2f(location, value.x, value.y);
     }
 
     void OpenGLShader::UploadUniformFloat3(const std::string& name, const glm::vec3& value) {
-        GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint location = GetUniformLocation(name);
         glUniform3f(location, value.x, value.y, value.z);
     }
 
     void OpenGLShader::UploadUniformFloat4(const std::string& name, const glm::vec4& value) {
-        GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint location = GetUniformLocation(name);
         glUniform4f(location, value.x, value.y, value.z, value.w);
     }
 
     void OpenGLShader::UploadUniformMat3(const std::string& name, const glm::mat3& matrix) {
-        GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint location = GetUniformLocation(name);
         glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
     }
 
     void OpenGLShader::UploadUniformMat4(const std::string& name, const glm::mat4& matrix) {
-        GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint location = GetUniformLocation(name);
         glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
     }
 
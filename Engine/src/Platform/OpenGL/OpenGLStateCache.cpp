@@ -0,0 +1,247 @@
+#include "ClaudeEngine/Platform/OpenGL/OpenGLStateCache.h"
+#include <glad/glad.h>
+
+namespace ClaudeEngine {
+
+    static int CapabilityToIndex(GLenum capability) {
+        switch (capability) {
+            case GL_BLEND:       return 0;
+            case GL_DEPTH_TEST:  return 1;
+            case GL_CULL_FACE:   return 2;
+            case GL_LINE_SMOOTH: return 3;
+        }
+        return -1;
+    }
+
+    void OpenGLStateCache::Invalidate() {
+        m_Capabilities.fill(-1);
+        m_Program = Unknown;
+        m_VertexArray = Unknown;
+        m_ArrayBuffer = Unknown;
+        m_DrawIndirectBuffer = Unknown;
+        m_ParameterBuffer = Unknown;
+        m_PixelPackBuffer = Unknown;
+        m_Framebuffer = Unknown;
+        m_TextureUnits.fill(Unknown);
+        m_UniformBindings.fill(IndexedBinding());
+        m_StorageBindings.fill(IndexedBinding());
+        m_ImageUnits.fill(ImageBinding());
+        m_BlendSource = Unknown;
+        m_BlendDestination = Unknown;
+        m_DepthMask = -1;
+        m_DepthFunc = Unknown;
+        m_ColorMask = -1;
+        m_ViewportValid = false;
+        m_ClearColorValid = false;
+    }
+
+    void OpenGLStateCache::InvalidateTextureUnits() {
+        m_TextureUnits.fill(Unknown);
+    }
+
+    bool OpenGLStateCache::Changed(bool changed) {
+        if (changed)
+            m_Counters.Issued++;
+        else
+            m_Counters.Filtered++;
+        return changed;
+    }
+
+    void OpenGLStateCache::UseProgram(uint32_t program) {
+        if (Changed(m_Program != program)) {
+            glUseProgram(program);
+            m_Program = program;
+        }
+    }
+
+    void OpenGLStateCache::BindVertexArray(uint32_t vertexArray) {
+        if (Changed(m_VertexArray != vertexArray)) {
+            glBindVertexArray(vertexArray);
+            m_VertexArray = vertexArray;
+        }
+    }
+
+    void OpenGLStateCache::BindBuffer(uint32_t target, uint32_t buffer) {
+        uint32_t* binding = nullptr;
+        if (target == GL_ARRAY_BUFFER)
+            binding = &m_ArrayBuffer;
+        else if (target == GL_DRAW_INDIRECT_BUFFER)
+            binding = &m_DrawIndirectBuffer;
+        else if (target == GL_PARAMETER_BUFFER)
+            binding = &m_ParameterBuffer;
+        else if (target == GL_PIXEL_PACK_BUFFER)
+            binding = &m_PixelPackBuffer;
+
+        if (Changed(!binding || *binding != buffer)) {
+            glBindBuffer(target, buffer);
+            if (binding)
+                *binding = buffer;
+        }
+    }
+
+    void OpenGLStateCache::BindBufferRange(uint32_t target, uint32_t index, uint32_t buffer, ptrdiff_t offset, ptrdiff_t size) {
+        IndexedBinding* binding = nullptr;
+        if (index < MaxIndexedBindings) {
+            if (target == GL_UNIFORM_BUFFER)
+                binding = &m_UniformBindings[index];
+            else if (target == GL_SHADER_STORAGE_BUFFER)
+                binding = &m_StorageBindings[index];
+        }
+
+        bool changed = !binding || binding->Buffer != buffer || binding->Offset != offset || binding->Size != size;
+        if (!Changed(changed))
+            return;
+
+        if (size == 0)
+            glBindBufferBase(target, index, buffer);
+        else
+            glBindBufferRange(target, index, buffer, offset, size);
+
+        if (binding)
+            *binding = { buffer, offset, size };
+    }
+
+    void OpenGLStateCache::BindTextureUnit(uint32_t unit, uint32_t texture) {
+        if (unit >= MaxTextureUnits) {
+            Changed(true);
+            glBindTextureUnit(unit, texture);
+            return;
+        }
+
+        if (Changed(m_TextureUnits[unit] != texture)) {
+            glBindTextureUnit(unit, texture);
+            m_TextureUnits[unit] = texture;
+        }
+    }
+
+    void OpenGLStateCache::BindImageTexture(uint32_t unit, uint32_t texture, uint32_t level, uint32_t access, uint32_t format) {
+        ImageBinding* binding = unit < MaxIndexedBindings ? &m_ImageUnits[unit] : nullptr;
+        bool changed = !binding || binding->Texture != texture || binding->Level != level ||
+                       binding->Access != access || binding->Format != format;
+        if (!Changed(changed))
+            return;
+
+        glBindImageTexture(unit, texture, level, GL_FALSE, 0, access, format);
+        if (binding)
+            *binding = { texture, level, access, format };
+    }
+
+    void OpenGLStateCache::BindFramebuffer(uint32_t framebuffer) {
+        if (Changed(m_Framebuffer != framebuffer)) {
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+            m_Framebuffer = framebuffer;
+        }
+    }
+
+    void OpenGLStateCache::SetEnabled(uint32_t capability, bool enabled) {
+        int index = CapabilityToIndex(capability);
+        int8_t state = enabled ? 1 : 0;
+        if (!Changed(index < 0 || m_Capabilities[index] != state))
+            return;
+
+        if (enabled)
+            glEnable(capability);
+        else
+            glDisable(capability);
+
+        if (index >= 0)
+            m_Capabilities[index] = state;
+    }
+
+    void OpenGLStateCache::SetBlendFunc(uint32_t source, uint32_t destination) {
+        if (Changed(m_BlendSource != source || m_BlendDestination != destination)) {
+            glBlendFunc(source, destination);
+            m_BlendSource = source;
+            m_BlendDestination = destination;
+        }
+    }
+
+    void OpenGLStateCache::SetDepthMask(bool write) {
+        int8_t state = write ? 1 : 0;
+        if (Changed(m_DepthMask != state)) {
+            glDepthMask(write ? GL_TRUE : GL_FALSE);
+            m_DepthMask = state;
+        }
+    }
+
+    void OpenGLStateCache::SetDepthFunc(uint32_t function) {
+        if (Changed(m_DepthFunc != function)) {
+            glDepthFunc(function);
+            m_DepthFunc = function;
+        }
+    }
+
+    void OpenGLStateCache::SetColorMask(bool write) {
+        int8_t state = write ? 1 : 0;
+        if (Changed(m_ColorMask != state)) {
+            GLboolean mask = write ? GL_TRUE : GL_FALSE;
+            glColorMask(mask, mask, mask, mask);
+            m_ColorMask = state;
+        }
+    }
+
+    void OpenGLStateCache::SetViewport(int32_t x, int32_t y, int32_t width, int32_t height) {
+        std::array<int32_t, 4> viewport = { x, y, width, height };
+        if (Changed(!m_ViewportValid || m_Viewport != viewport)) {
+            glViewport(x, y, width, height);
+            m_Viewport = viewport;
+            m_ViewportValid = true;
+        }
+    }
+
+    void OpenGLStateCache::SetClearColor(const glm::vec4& color) {
+        if (Changed(!m_ClearColorValid || m_ClearColor != color)) {
+            glClearColor(color.r, color.g, color.b, color.a);
+            m_ClearColor = color;
+            m_ClearColorValid = true;
+        }
+    }
+
+    void OpenGLStateCache::OnProgramDeleted(uint32_t program) {
+        // A current program survives deletion until it is replaced, so only forget it
+        if (m_Program == program)
+            m_Program = Unknown;
+    }
+
+    void OpenGLStateCache::OnVertexArrayDeleted(uint32_t vertexArray) {
+        if (m_VertexArray == vertexArray)
+            m_VertexArray = 0;
+    }
+
+    void OpenGLStateCache::OnBufferDeleted(uint32_t buffer) {
+        if (m_ArrayBuffer == buffer)
+            m_ArrayBuffer = 0;
+        if (m_DrawIndirectBuffer == buffer)
+            m_DrawIndirectBuffer = 0;
+        if (m_ParameterBuffer == buffer)
+            m_ParameterBuffer = 0;
+        if (m_PixelPackBuffer == buffer)
+            m_PixelPackBuffer = 0;
+
+        for (auto& binding : m_UniformBindings) {
+            if (binding.Buffer == buffer)
+                binding = IndexedBinding();
+        }
+        for (auto& binding : m_StorageBindings) {
+            if (binding.Buffer == buffer)
+                binding = IndexedBinding();
+        }
+    }
+
+    void OpenGLStateCache::OnTextureDeleted(uint32_t texture) {
+        for (auto& unit : m_TextureUnits) {
+            if (unit == texture)
+                unit = 0;
+        }
+        for (auto& image : m_ImageUnits) {
+            if (image.Texture == texture)
+                image = ImageBinding();
+        }
+    }
+
+    void OpenGLStateCache::OnFramebufferDeleted(uint32_t framebuffer) {
+        if (m_Framebuffer == framebuffer)
+            m_Framebuffer = 0;
+    }
+
+}
@@ -0,0 +1,118 @@
+#include "ClaudeEngine/Platform/OpenGL/OpenGLStorageBuffer.h"
+#include "ClaudeEngine/Platform/OpenGL/OpenGLRenderAPI.h"
+#include "ClaudeEngine/Core/Log.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstring>
+
+namespace ClaudeEngine {
+
+    // Mapped buffers advance together at the end of each frame; GL thread only
+    static std::vector<OpenGLStorageBuffer*> s_MappedBuffers;
+
+    OpenGLStorageBuffer::OpenGLStorageBuffer(uint32_t segmentSize, uint32_t segmentCount, uint32_t binding)
+        : m_Binding(binding), m_SegmentCount(segmentCount) {
+        // Allocations are bound with glBindBufferRange, so their offsets must respect the alignment
+        GLint alignment = 1;
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        m_Alignment = (uint32_t)alignment;
+        m_SegmentSize = (segmentSize + m_Alignment - 1) / m_Alignment * m_Alignment;
+
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        GLsizeiptr totalSize = (GLsizeiptr)m_SegmentSize * m_SegmentCount;
+
+        glCreateBuffers(1, &m_RendererID);
+        glNamedBufferStorage(m_RendererID, totalSize, nullptr, flags);
+        m_MappedData = (uint8_t*)glMapNamedBufferRange(m_RendererID, 0, totalSize, flags);
+        CE_CORE_ASSERT(m_MappedData, "Failed to persistently map storage buffer!");
+        // Mapped storage starts out undefined; ranges read back before anything wrote them read 0
+        std::memset(m_MappedData, 0, totalSize);
+
+        m_Fences.resize(m_SegmentCount, nullptr);
+        s_MappedBuffers.push_back(this);
+    }
+
+    OpenGLStorageBuffer::OpenGLStorageBuffer(uint32_t size, uint32_t binding)
+        : m_Binding(binding), m_SegmentSize(size), m_SegmentCount(1) {
+        // No client access flags lets the driver keep it in video memory
+        glCreateBuffers(1, &m_RendererID);
+        glNamedBufferStorage(m_RendererID, size, nullptr, 0);
+    }
+
+    OpenGLStorageBuffer::~OpenGLStorageBuffer() {
+        if (m_MappedData)
+            s_MappedBuffers.erase(std::find(s_MappedBuffers.begin(), s_MappedBuffers.end(), this));
+
+        for (GLsync fence : m_Fences) {
+            if (fence)
+                glDeleteSync(fence);
+        }
+        if (m_MappedData)
+            glUnmapNamedBuffer(m_RendererID);
+        glDeleteBuffers(1, &m_RendererID);
+        OpenGLRenderAPI::GetStateCache().OnBufferDeleted(m_RendererID);
+    }
+
+    void* OpenGLStorageBuffer::Allocate(uint32_t size) {
+        OpenGLStateCache& cache = OpenGLRenderAPI::GetStateCache();
+        if (!m_MappedData) {
+            // The GPU orders its own reads and writes, so there is nothing to wait for
+            CE_CORE_ASSERT(size <= m_SegmentSize, "GPU-only storage buffer too small!");
+            cache.BindBufferRange(GL_SHADER_STORAGE_BUFFER, m_Binding, m_RendererID, 0, m_SegmentSize);
+            m_AllocationOffset = 0;
+            return nullptr;
+        }
+
+        CE_CORE_ASSERT(size <= m_SegmentSize, "Allocation larger than a storage buffer segment!");
+        if (!m_SegmentOpen)
+            WaitForSegment();
+
+        uint32_t offset = (m_Cursor + m_Alignment - 1) / m_Alignment * m_Alignment;
+        if (offset + size > m_SegmentSize) {
+            // Not sized for this frame; hand the full segment to the GPU and carry on in the next
+            if (!m_WarnedFull)
+                CE_CORE_WARN("Storage buffer ", m_RendererID, " outgrew its frame segment; frames may stall");
+            m_WarnedFull = true;
+            FenceSegment();
+            WaitForSegment();
+            offset = 0;
+        }
+        m_Cursor = offset + size;
+
+        m_AllocationOffset = m_SegmentSize * m_CurrentSegment + offset;
+        cache.BindBufferRange(GL_SHADER_STORAGE_BUFFER, m_Binding, m_RendererID, m_AllocationOffset, std::max(size, 1u));
+        return m_MappedData + m_AllocationOffset;
+    }
+
+    void OpenGLStorageBuffer::WaitForSegment() {
+        GLsync& fence = m_Fences[m_CurrentSegment];
+        if (fence) {
+            GLenum result = glClientWaitSync(fence, 0, 0);
+            while (result == GL_TIMEOUT_EXPIRED)
+                result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+        m_Cursor = 0;
+        m_SegmentOpen = true;
+    }
+
+    void OpenGLStorageBuffer::FenceSegment() {
+        m_Fences[m_CurrentSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        m_CurrentSegment = (m_CurrentSegment + 1) % m_SegmentCount;
+        m_SegmentOpen = false;
+    }
+
+    void OpenGLStorageBuffer::EndFrameAll() {
+        // Buffers untouched this frame keep their segment
+        for (OpenGLStorageBuffer* buffer : s_MappedBuffers) {
+            if (buffer->m_SegmentOpen)
+                buffer->FenceSegment();
+        }
+    }
+
+    void OpenGLStorageBuffer::GetData(void* data, uint32_t size, uint32_t offset) const {
+        glGetNamedBufferSubData(m_RendererID, (GLintptr)m_AllocationOffset + offset, size, data);
+    }
+
+}
@@ -0,0 +1,107 @@
+#include "ClaudeEngine/Platform/OpenGL/OpenGLStreamBuffer.h"
+#include "ClaudeEngine/Platform/OpenGL/OpenGLRenderAPI.h"
+#include "ClaudeEngine/Core/Log.h"
+#include <glad/glad.h>
+#include <algorithm>
+
+namespace ClaudeEngine {
+
+    OpenGLStreamBuffer::OpenGLStreamBuffer(uint32_t size)
+        : m_Size(size) {
+        GLint alignment = 1;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        m_UniformAlignment = (uint32_t)std::max(alignment, 16);
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        m_StorageAlignment = (uint32_t)std::max(alignment, 16);
+
+        // Coherent mapping makes CPU writes visible to draws issued afterwards without flushes
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCreateBuffers(1, &m_RendererID);
+        glNamedBufferStorage(m_RendererID, m_Size, nullptr, flags);
+        m_MappedData = (uint8_t*)glMapNamedBufferRange(m_RendererID, 0, m_Size, flags);
+        CE_CORE_ASSERT(m_MappedData, "Failed to persistently map stream buffer!");
+
+        m_Stats.Size = m_Size;
+    }
+
+    OpenGLStreamBuffer::~OpenGLStreamBuffer() {
+        for (const FrameFence& frame : m_Frames)
+            glDeleteSync(frame.Fence);
+        if (m_MappedData)
+            glUnmapNamedBuffer(m_RendererID);
+        glDeleteBuffers(1, &m_RendererID);
+        OpenGLRenderAPI::GetStateCache().OnBufferDeleted(m_RendererID);
+    }
+
+    StreamAllocation OpenGLStreamBuffer::Allocate(uint32_t size, Usage usage) {
+        CE_CORE_ASSERT(size <= m_Size / 2, "Stream allocation is larger than half the ring!");
+
+        uint32_t alignment = 16;
+        if (usage == Usage::Uniform)
+            alignment = m_UniformAlignment;
+        else if (usage == Usage::Storage)
+            alignment = m_StorageAlignment;
+
+        // With nothing in flight the whole ring is free; start over instead of skipping the tail
+        if (m_Used == 0)
+            m_Head = 0;
+
+        uint32_t offset = (m_Head + alignment - 1) / alignment * alignment;
+        if (offset + size > m_Size) {
+            // The tail end is skipped; its bytes stay claimed until this frame retires
+            offset = 0;
+            m_Stats.Wraps++;
+        }
+        // Tail plus allocation can exceed the ring when it overlaps the start of the previous
+        // span; claiming all of it then waits for everything in flight, and no more
+        uint32_t claimed = std::min((offset >= m_Head ? offset - m_Head : m_Size - m_Head) + size, m_Size);
+
+        while (m_Used + claimed > m_Size) {
+            if (m_Frames.empty()) {
+                // This frame alone filled the ring; fence the part already issued and wait on it
+                m_Frames.push_back({ glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), m_FrameBytes });
+                m_FrameBytes = 0;
+            }
+            RetireOldestFrame();
+        }
+
+        m_Head = offset + size;
+        m_Used += claimed;
+        m_FrameBytes += claimed;
+        m_FrameTotal += claimed;
+
+        return { m_MappedData + offset, offset, size };
+    }
+
+    void OpenGLStreamBuffer::RetireOldestFrame() {
+        FrameFence frame = m_Frames.front();
+        m_Frames.pop_front();
+
+        GLenum result = glClientWaitSync(frame.Fence, 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED) {
+            m_Stats.Stalls++;
+            while (result == GL_TIMEOUT_EXPIRED)
+                result = glClientWaitSync(frame.Fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+        }
+        glDeleteSync(frame.Fence);
+        m_Used -= frame.Bytes;
+    }
+
+    void OpenGLStreamBuffer::Bind(Usage usage, uint32_t binding, const StreamAllocation& allocation) {
+        CE_CORE_ASSERT(usage != Usage::Vertex, "Vertex stream allocations have no indexed binding!");
+        GLenum target = usage == Usage::Uniform ? GL_UNIFORM_BUFFER : GL_SHADER_STORAGE_BUFFER;
+        OpenGLRenderAPI::GetStateCache().BindBufferRange(target, binding, m_RendererID, allocation.Offset, allocation.Size);
+    }
+
+    void OpenGLStreamBuffer::EndFrame() {
+        if (m_FrameBytes > 0) {
+            m_Frames.push_back({ glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), m_FrameBytes });
+            m_FrameBytes = 0;
+        }
+
+        m_Stats.FrameBytes = m_FrameTotal;
+        m_Stats.PeakFrameBytes = std::max(m_Stats.PeakFrameBytes, m_FrameTotal);
+        m_FrameTotal = 0;
+    }
+
+}
@@ -1,4 +1,5 @@
 #include "ClaudeEngine/Platform/OpenGL/OpenGLTexture.h"
+#include "ClaudeEngine/Platform/OpenGL/OpenGLRenderAPI.h"
 #include "ClaudeEngine/Core/Log.h"
 #include <glad/glad.h>
 
@@ -66,6 +67,7 @@ namespace ClaudeEngine {
 
     OpenGLTexture2D::~OpenGLTexture2D() {
         glDeleteTextures(1, &m_RendererID);
+        OpenGLRenderAPI::GetStateCache().OnTextureDeleted(m_RendererID);
     }
 
     void OpenGLTexture2D::SetData(void* data, uint32_t size) {
@@ -75,7 +77,7 @@ namespace ClaudeEngine {
     }
 
     void OpenGLTexture2D::Bind(uint32_t slot) const {
-        glBindTextureUnit(slot, m_RendererID);
+        OpenGLRenderAPI::GetStateCache().BindTextureUnit(slot, m_RendererID);
     }
 
 }
@@ -0,0 +1,27 @@
+#include "ClaudeEngine/Platform/OpenGL/OpenGLUniformBuffer.h"
+#include "ClaudeEngine/Platform/OpenGL/OpenGLRenderAPI.h"
+#include <glad/glad.h>
+
+namespace ClaudeEngine {
+
+    OpenGLUniformBuffer::OpenGLUniformBuffer(uint32_t size, uint32_t binding)
+        : m_Binding(binding), m_Size(size) {
+        glCreateBuffers(1, &m_RendererID);
+        glNamedBufferData(m_RendererID, size, nullptr, GL_DYNAMIC_DRAW);
+        OpenGLRenderAPI::GetStateCache().BindBufferRange(GL_UNIFORM_BUFFER, binding, m_RendererID, 0, size);
+    }
+
+    OpenGLUniformBuffer::~OpenGLUniformBuffer() {
+        glDeleteBuffers(1, &m_RendererID);
+        OpenGLRenderAPI::GetStateCache().OnBufferDeleted(m_RendererID);
+    }
+
+    void OpenGLUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+        glNamedBufferSubData(m_RendererID, offset, size, data);
+    }
+
+    void OpenGLUniformBuffer::Bind() const {
+        OpenGLRenderAPI::GetStateCache().BindBufferRange(GL_UNIFORM_BUFFER, m_Binding, m_RendererID, 0, m_Size);
+    }
+
+}
@@ -1,4 +1,5 @@
 #include "ClaudeEngine/Platform/OpenGL/OpenGLVertexArray.h"
+#include "ClaudeEngine/Platform/OpenGL/OpenGLRenderAPI.h"
 #include <glad/glad.h>
 
 namespace ClaudeEngine {
@@ -16,6 +17,9 @@ namespace ClaudeEngine {
             case ShaderDataType::Int3:     return GL_INT;
             case ShaderDataType::Int4:     return GL_INT;
             case ShaderDataType::Bool:     return GL_BOOL;
+            case ShaderDataType::Short2:   return GL_SHORT;
+            case ShaderDataType::Short4:   return GL_SHORT;
+            case ShaderDataType::Half2:    return GL_HALF_FLOAT;
             default:
                 CE_CORE_ASSERT(false, "Unknown ShaderDataType!");
                 return 0;
@@ -28,67 +32,64 @@ namespace ClaudeEngine {
 
     OpenGLVertexArray::~OpenGLVertexArray() {
         glDeleteVertexArrays(1, &m_RendererID);
+        OpenGLRenderAPI::GetStateCache().OnVertexArrayDeleted(m_RendererID);
     }
 
     void OpenGLVertexArray::Bind() const {
-        glBindVertexArray(m_RendererID);
+        OpenGLRenderAPI::GetStateCache().BindVertexArray(m_RendererID);
     }
 
     void OpenGLVertexArray::Unbind() const {
-        glBindVertexArray(0);
+        OpenGLRenderAPI::GetStateCache().BindVertexArray(0);
     }
 
     void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) {
         CE_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
 
-        glBindVertexArray(m_RendererID);
-        vertexBuffer->Bind();
-
+        // Each buffer gets its own binding slot. Attribute formats only reference the slot, so
+        // SetVertexBuffer can swap the buffer without touching them.
+        const uint32_t slot = (uint32_t)m_VertexBuffers.size();
         const auto& layout = vertexBuffer->GetLayout();
+        glVertexArrayVertexBuffer(m_RendererID, slot, vertexBuffer->GetRendererID(), 0, layout.GetStride());
+        glVertexArrayBindingDivisor(m_RendererID, slot, layout.IsInstanced() ? 1 : 0);
+
+        auto addAttribute = [&](const BufferElement& element, uint32_t componentCount, uint32_t relativeOffset, bool integer) {
+            glEnableVertexArrayAttrib(m_RendererID, m_VertexBufferIndex);
+            if (integer) {
+                glVertexArrayAttribIFormat(m_RendererID, m_VertexBufferIndex, componentCount,
+                    ShaderDataTypeToOpenGLBaseType(element.Type), relativeOffset);
+            } else {
+                glVertexArrayAttribFormat(m_RendererID, m_VertexBufferIndex, componentCount,
+                    ShaderDataTypeToOpenGLBaseType(element.Type), element.Normalized ? GL_TRUE : GL_FALSE, relativeOffset);
+            }
+            glVertexArrayAttribBinding(m_RendererID, m_VertexBufferIndex, slot);
+            m_VertexBufferIndex++;
+        };
+
         for (const auto& element : layout) {
             switch (element.Type) {
                 case ShaderDataType::Float:
                 case ShaderDataType::Float2:
                 case ShaderDataType::Float3:
-                case ShaderDataType::Float4: {
-                    glEnableVertexAttribArray(m_VertexBufferIndex);
-                    glVertexAttribPointer(m_VertexBufferIndex,
-                        element.GetComponentCount(),
-                        ShaderDataTypeToOpenGLBaseType(element.Type),
-                        element.Normalized ? GL_TRUE : GL_FALSE,
-                        layout.GetStride(),
-                        (const void*)element.Offset);
-                    m_VertexBufferIndex++;
+                case ShaderDataType::Float4:
+                case ShaderDataType::Short2:
+                case ShaderDataType::Short4:
+                case ShaderDataType::Half2:
+                    addAttribute(element, element.GetComponentCount(), (uint32_t)element.Offset, false);
                     break;
-                }
                 case ShaderDataType::Int:
                 case ShaderDataType::Int2:
                 case ShaderDataType::Int3:
                 case ShaderDataType::Int4:
-                case ShaderDataType::Bool: {
-                    glEnableVertexAttribArray(m_VertexBufferIndex);
-                    glVertexAttribIPointer(m_VertexBufferIndex,
-                        element.GetComponentCount(),
-                        ShaderDataTypeToOpenGLBaseType(element.Type),
-                        layout.GetStride(),
-                        (const void*)element.Offset);
-                    m_VertexBufferIndex++;
+                case ShaderDataType::Bool:
+                    addAttribute(element, element.GetComponentCount(), (uint32_t)element.Offset, true);
                     break;
-                }
                 case ShaderDataType::Mat3:
                 case ShaderDataType::Mat4: {
-                    uint8_t count = element.GetComponentCount();
-                    for (uint8_t i = 0; i < count; i++) {
-                        glEnableVertexAttribArray(m_VertexBufferIndex);
-                        glVertexAttribPointer(m_VertexBufferIndex,
-                            count,
-                            ShaderDataTypeToOpenGLBaseType(element.Type),
-                            element.Normalized ? GL_TRUE : GL_FALSE,
-                            layout.GetStride(),
-                            (const void*)(element.Offset + sizeof(float) * count * i));
-                        glVertexAttribDivisor(m_VertexBufferIndex, 1);
-                        m_VertexBufferIndex++;
-                    }
+                    // One attribute per column; put matrices in an instanced layout to step per instance
+                    uint32_t count = element.GetComponentCount();
+                    for (uint32_t i = 0; i < count; i++)
+                        addAttribute(element, count, (uint32_t)(element.Offset + sizeof(float) * count * i), false);
                     break;
                 }
                 default:
@@ -99,10 +100,17 @@ namespace ClaudeEngine {
         m_VertexBuffers.push_back(vertexBuffer);
     }
 
-    void OpenGLVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) {
-        glBindVertexArray(m_RendererID);
-        indexBuffer->Bind();
+    void OpenGLVertexArray::SetVertexBuffer(uint32_t slot, const Ref<VertexBuffer>& vertexBuffer) {
+        CE_CORE_ASSERT(slot < m_VertexBuffers.size(), "Vertex buffer slot was never added!");
+        CE_CORE_ASSERT(vertexBuffer->GetLayout().GetStride() == m_VertexBuffers[slot]->GetLayout().GetStride(),
+                       "Vertex buffer layout does not match the slot!");
 
+        glVertexArrayVertexBuffer(m_RendererID, slot, vertexBuffer->GetRendererID(), 0, vertexBuffer->GetLayout().GetStride());
+        m_VertexBuffers[slot] = vertexBuffer;
+    }
+
+    void OpenGLVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) {
+        glVertexArrayElementBuffer(m_RendererID, indexBuffer->GetRendererID());
         m_IndexBuffer = indexBuffer;
     }
 
@@ -4,39 +4,52 @@
 
 namespace ClaudeEngine {
 
-    Ref<VertexBuffer> VertexBuffer::Create(uint32_t size) {
+    Ref<VertexBuffer> VertexBuffer::Create(uint32_t size, BufferUsage usage) {
         switch (Renderer::GetAPI()) {
             case RenderAPI::API::None:    
                 CE_CORE_ASSERT(false, "RenderAPI::None is not supported!");
                 return nullptr;
             case RenderAPI::API::OpenGL:  
-                return CreateRef<OpenGLVertexBuffer>(size);
+                return CreateRef<OpenGLVertexBuffer>(size, usage);
         }
 
         CE_CORE_ASSERT(false, "Unknown RendererAPI!");
         return nullptr;
     }
 
-    Ref<VertexBuffer> VertexBuffer::Create(float* vertices, uint32_t size) {
+    Ref<VertexBuffer> VertexBuffer::Create(float* vertices, uint32_t size, BufferUsage usage) {
         switch (Renderer::GetAPI()) {
             case RenderAPI::API::None:    
                 CE_CORE_ASSERT(false, "RenderAPI::None is not supported!");
                 return nullptr;
             case RenderAPI::API::OpenGL:  
-                return CreateRef<OpenGLVertexBuffer>(vertices, size);
+                return CreateRef<OpenGLVertexBuffer>(vertices, size, usage);
         }
 
         CE_CORE_ASSERT(false, "Unknown RendererAPI!");
         return nullptr;
     }
 
-    Ref<IndexBuffer> IndexBuffer::Create(uint32_t* indices, uint32_t count) {
+    Ref<IndexBuffer> IndexBuffer::Create(uint32_t count, IndexType type, BufferUsage usage) {
         switch (Renderer::GetAPI()) {
             case RenderAPI::API::None:    
                 CE_CORE_ASSERT(false, "RenderAPI::None is not supported!");
                 return nullptr;
             case RenderAPI::API::OpenGL:  
-                return CreateRef<OpenGLIndexBuffer>(indices, count);
+                return CreateRef<OpenGLIndexBuffer>(count, type, usage);
+        }
+
+        CE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+    Ref<IndexBuffer> IndexBuffer::Create(uint32_t* indices, uint32_t count, BufferUsage usage) {
+        switch (Renderer::GetAPI()) {
+            case RenderAPI::API::None:    
+                CE_CORE_ASSERT(false, "RenderAPI::None is not supported!");
+                return nullptr;
+            case RenderAPI::API::OpenGL:  
+                return CreateRef<OpenGLIndexBuffer>(indices, count, usage);
         }
 
         CE_CORE_ASSERT(false, "Unknown RendererAPI!");
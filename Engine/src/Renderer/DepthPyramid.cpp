@@ -0,0 +1,20 @@
+#include "ClaudeEngine/Renderer/DepthPyramid.h"
+#include "ClaudeEngine/Renderer/Renderer.h"
+#include "ClaudeEngine/Platform/OpenGL/OpenGLDepthPyramid.h"
+
+namespace ClaudeEngine {
+
+    Ref<DepthPyramid> DepthPyramid::Create() {
+        switch (Renderer::GetAPI()) {
+            case RenderAPI::API::None:
+                CE_CORE_ASSERT(false, "RenderAPI::None is not supported!");
+                return nullptr;
+            case RenderAPI::API::OpenGL:
+                return CreateRef<OpenGLDepthPyramid>();
+        }
+
+        CE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+}
@@ -25,6 +25,17 @@ namespace ClaudeEngine {
         m_ViewMatrix = glm::inverse(m_ViewMatrix);
     }
 
+    Ray EditorCamera::ScreenPointToRay(float x, float y) const {
+        glm::vec2 ndc(2.0f * x / m_ViewportWidth - 1.0f, 1.0f - 2.0f * y / m_ViewportHeight);
+        glm::mat4 inverseViewProjection = glm::inverse(GetViewProjection());
+
+        glm::vec4 nearPoint = inverseViewProjection * glm::vec4(ndc.x, ndc.y, -1.0f, 1.0f);
+        glm::vec4 farPoint = inverseViewProjection * glm::vec4(ndc.x, ndc.y, 1.0f, 1.0f);
+        glm::vec3 origin = glm::vec3(nearPoint) / nearPoint.w;
+        glm::vec3 target = glm::vec3(farPoint) / farPoint.w;
+        return Ray(origin, glm::normalize(target - origin));
+    }
+
     std::pair<float, float> EditorCamera::PanSpeed() const {
         float x = std::min(m_ViewportWidth / 1000.0f, 2.4f);
         float xFactor = 0.0366f * (x * x) - 0.1778f * x + 0.3021f;
@@ -0,0 +1,102 @@
+#include "ClaudeEngine/Renderer/FramePipeline.h"
+#include <chrono>
+
+namespace ClaudeEngine {
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    static float ElapsedMs(Clock::time_point start) {
+        return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+    }
+
+    FramePipeline::~FramePipeline() {
+        if (!m_Producer.joinable())
+            return;
+
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Condition.wait(lock, [&] { return !m_Busy; });
+            m_Quit = true;
+        }
+        m_Condition.notify_all();
+        m_Producer.join();
+    }
+
+    void FramePipeline::Draw(const PrepareFunction& prepare, const DrawFunction& draw) {
+        m_Frame++;
+
+        auto start = Clock::now();
+        Wait();
+        m_Timings.WaitMs = ElapsedMs(start);
+
+        if (m_Pipelined && m_Pending) {
+            m_Front ^= 1;
+            m_Timings.PrepareMs = m_TaskMs;
+        } else {
+            // Nothing launched (first frame, or just switched modes), or direct mode
+            RenderSnapshot& snapshot = m_Snapshots[m_Front];
+            snapshot.Frame = m_Frame;
+            start = Clock::now();
+            prepare(snapshot);
+            m_Timings.PrepareMs = ElapsedMs(start);
+        }
+        m_Pending = false;
+
+        RenderSnapshot& front = m_Snapshots[m_Front];
+        m_Timings.LatencyFrames = (uint32_t)(m_Frame - front.Frame);
+        start = Clock::now();
+        draw(front);
+        m_Timings.SubmitMs = ElapsedMs(start);
+    }
+
+    void FramePipeline::Launch(PrepareFunction prepare) {
+        if (!m_Pipelined)
+            return;
+
+        Wait();
+        if (!m_Producer.joinable())
+            m_Producer = std::thread(&FramePipeline::ProducerLoop, this);
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_TaskSnapshot = &m_Snapshots[m_Front ^ 1];
+            m_TaskSnapshot->Frame = m_Frame;
+            m_Task = std::move(prepare);
+            m_Busy = true;
+        }
+        m_Pending = true;
+        m_Condition.notify_all();
+    }
+
+    void FramePipeline::Wait() {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Condition.wait(lock, [&] { return !m_Busy; });
+    }
+
+    void FramePipeline::ProducerLoop() {
+        for (;;) {
+            PrepareFunction task;
+            RenderSnapshot* snapshot;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_Condition.wait(lock, [&] { return m_Quit || m_Busy; });
+                if (m_Quit)
+                    return;
+                task = std::move(m_Task);
+                snapshot = m_TaskSnapshot;
+            }
+
+            auto start = Clock::now();
+            task(*snapshot);
+            float elapsed = ElapsedMs(start);
+
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_TaskMs = elapsed;
+                m_Busy = false;
+            }
+            m_Condition.notify_all();
+        }
+    }
+
+}
@@ -1,9 +1,19 @@
 #include "ClaudeEngine/Renderer/Framebuffer.h"
 #include "ClaudeEngine/Platform/OpenGL/OpenGLFramebuffer.h"
 #include "ClaudeEngine/Renderer/RenderAPI.h"
+#include <algorithm>
 
 namespace ClaudeEngine {
 
+    std::vector<int> PixelReadback::GetUniqueValues(int ignoreValue) const {
+        std::vector<int> unique;
+        for (int value : Values) {
+            if (value != ignoreValue && std::find(unique.begin(), unique.end(), value) == unique.end())
+                unique.push_back(value);
+        }
+        return unique;
+    }
+
     Ref<Framebuffer> Framebuffer::Create(const FramebufferSpecification& spec) {
         switch (RenderAPI::GetAPI()) {
             case RenderAPI::API::None:
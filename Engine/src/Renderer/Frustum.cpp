@@ -0,0 +1,114 @@
+#include "ClaudeEngine/Renderer/Frustum.h"
+#include <cmath>
+#include <utility>
+
+namespace ClaudeEngine {
+
+    void AABB::Expand(const glm::vec3& point) {
+        Min = glm::min(Min, point);
+        Max = glm::max(Max, point);
+    }
+
+    void AABB::Expand(const AABB& other) {
+        if (!other.IsValid())
+            return;
+        Min = glm::min(Min, other.Min);
+        Max = glm::max(Max, other.Max);
+    }
+
+    bool AABB::Intersects(const Ray& ray, float maxDistance, float& distance) const {
+        float tMin = 0.0f;
+        float tMax = maxDistance;
+        for (int axis = 0; axis < 3; axis++) {
+            float origin = ray.Origin[axis];
+            float direction = ray.Direction[axis];
+            if (std::fabs(direction) < 1e-8f) {
+                if (origin < Min[axis] || origin > Max[axis])
+                    return false;
+                continue;
+            }
+
+            float invDirection = 1.0f / direction;
+            float t0 = (Min[axis] - origin) * invDirection;
+            float t1 = (Max[axis] - origin) * invDirection;
+            if (t0 > t1)
+                std::swap(t0, t1);
+
+            tMin = t0 > tMin ? t0 : tMin;
+            tMax = t1 < tMax ? t1 : tMax;
+            if (tMin > tMax)
+                return false;
+        }
+
+        distance = tMin;
+        return true;
+    }
+
+    AABB AABB::Transform(const glm::mat4& transform) const {
+        if (!IsValid())
+            return *this;
+
+        // Transform the center, then project the extents onto the world axes
+        glm::vec3 center = glm::vec3(transform * glm::vec4(GetCenter(), 1.0f));
+        glm::vec3 extents = GetExtents();
+
+        glm::vec3 worldExtents(0.0f);
+        for (int axis = 0; axis < 3; axis++) {
+            worldExtents += glm::abs(glm::vec3(transform[axis])) * extents[axis];
+        }
+
+        return AABB(center - worldExtents, center + worldExtents);
+    }
+
+    void Frustum::Update(const glm::mat4& viewProjection) {
+        // glm is column major, so rows are gathered across columns
+        const glm::mat4& m = viewProjection;
+        glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+        glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+        glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+        glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+        glm::vec4 planes[Count] = {
+            row3 + row0, // Left
+            row3 - row0, // Right
+            row3 + row1, // Bottom
+            row3 - row1, // Top
+            row3 + row2, // Near
+            row3 - row2  // Far
+        };
+
+        for (int i = 0; i < Count; i++) {
+            glm::vec3 normal(planes[i]);
+            float length = glm::length(normal);
+            if (length > 0.0f) {
+                m_Planes[i].Normal = normal / length;
+                m_Planes[i].Distance = planes[i].w / length;
+            }
+        }
+    }
+
+    bool Frustum::Intersects(const AABB& box) const {
+        if (!box.IsValid())
+            return false;
+
+        glm::vec3 center = box.GetCenter();
+        glm::vec3 extents = box.GetExtents();
+
+        for (const Plane& plane : m_Planes) {
+            // Projected radius of the box onto the plane normal
+            float radius = glm::dot(extents, glm::abs(plane.Normal));
+            if (plane.GetSignedDistance(center) < -radius)
+                return false;
+        }
+        return true;
+    }
+
+    bool Frustum::Intersects(const glm::vec3& center, float radius) const {
+        for (const Plane& plane : m_Planes) {
+            if (plane.GetSignedDistance(center) < -radius)
+                return false;
+        }
+        return true;
+    }
+
+}
@@ -0,0 +1,164 @@
+#include "ClaudeEngine/Renderer/FrustumCuller.h"
+#include <cmath>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define CE_CULL_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define CE_CULL_SSE
+#endif
+
+namespace ClaudeEngine {
+
+    void BoundsSoA::Clear() {
+        CenterX.clear(); CenterY.clear(); CenterZ.clear();
+        ExtentX.clear(); ExtentY.clear(); ExtentZ.clear();
+    }
+
+    void BoundsSoA::Reserve(size_t count) {
+        CenterX.reserve(count); CenterY.reserve(count); CenterZ.reserve(count);
+        ExtentX.reserve(count); ExtentY.reserve(count); ExtentZ.reserve(count);
+    }
+
+    void BoundsSoA::Push(const AABB& box) {
+        glm::vec3 center = box.GetCenter();
+        glm::vec3 extents = box.GetExtents();
+        CenterX.push_back(center.x); CenterY.push_back(center.y); CenterZ.push_back(center.z);
+        ExtentX.push_back(extents.x); ExtentY.push_back(extents.y); ExtentZ.push_back(extents.z);
+    }
+
+    // Same test as Frustum::Intersects, unrolled over the SoA streams
+    static size_t CullRange(const Frustum& frustum, const BoundsSoA& bounds, uint8_t* visibility, size_t begin, size_t end) {
+        size_t visible = 0;
+        for (size_t i = begin; i < end; i++) {
+            bool inside = true;
+            for (int p = 0; p < Frustum::Count && inside; p++) {
+                const Plane& plane = frustum.GetPlane((Frustum::Side)p);
+                float distance = bounds.CenterX[i] * plane.Normal.x + bounds.CenterY[i] * plane.Normal.y
+                               + bounds.CenterZ[i] * plane.Normal.z + plane.Distance;
+                float radius = bounds.ExtentX[i] * std::fabs(plane.Normal.x) + bounds.ExtentY[i] * std::fabs(plane.Normal.y)
+                             + bounds.ExtentZ[i] * std::fabs(plane.Normal.z);
+                inside = distance + radius >= 0.0f;
+            }
+            visibility[i] = inside ? 1 : 0;
+            visible += inside ? 1 : 0;
+        }
+        return visible;
+    }
+
+    size_t FrustumCuller::CullScalar(const Frustum& frustum, const BoundsSoA& bounds, uint8_t* visibility) {
+        return CullRange(frustum, bounds, visibility, 0, bounds.Size());
+    }
+
+#if defined(CE_CULL_AVX2)
+
+    size_t FrustumCuller::Cull(const Frustum& frustum, const BoundsSoA& bounds, uint8_t* visibility) {
+        const size_t count = bounds.Size();
+        const size_t batchEnd = count & ~(size_t)7;
+
+        __m256 nx[Frustum::Count], ny[Frustum::Count], nz[Frustum::Count], nd[Frustum::Count];
+        __m256 ax[Frustum::Count], ay[Frustum::Count], az[Frustum::Count];
+        for (int p = 0; p < Frustum::Count; p++) {
+            const Plane& plane = frustum.GetPlane((Frustum::Side)p);
+            nx[p] = _mm256_set1_ps(plane.Normal.x);
+            ny[p] = _mm256_set1_ps(plane.Normal.y);
+            nz[p] = _mm256_set1_ps(plane.Normal.z);
+            nd[p] = _mm256_set1_ps(plane.Distance);
+            ax[p] = _mm256_set1_ps(std::fabs(plane.Normal.x));
+            ay[p] = _mm256_set1_ps(std::fabs(plane.Normal.y));
+            az[p] = _mm256_set1_ps(std::fabs(plane.Normal.z));
+        }
+        const __m256 zero = _mm256_setzero_ps();
+
+        size_t visible = 0;
+        for (size_t i = 0; i < batchEnd; i += 8) {
+            __m256 cx = _mm256_loadu_ps(&bounds.CenterX[i]);
+            __m256 cy = _mm256_loadu_ps(&bounds.CenterY[i]);
+            __m256 cz = _mm256_loadu_ps(&bounds.CenterZ[i]);
+            __m256 ex = _mm256_loadu_ps(&bounds.ExtentX[i]);
+            __m256 ey = _mm256_loadu_ps(&bounds.ExtentY[i]);
+            __m256 ez = _mm256_loadu_ps(&bounds.ExtentZ[i]);
+
+            __m256 outside = zero;
+            for (int p = 0; p < Frustum::Count; p++) {
+                __m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(cx, nx[p]), _mm256_mul_ps(cy, ny[p])),
+                                                _mm256_add_ps(_mm256_mul_ps(cz, nz[p]), nd[p]));
+                __m256 radius = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ex, ax[p]), _mm256_mul_ps(ey, ay[p])), _mm256_mul_ps(ez, az[p]));
+                outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(distance, radius), zero, _CMP_LT_OQ));
+            }
+
+            int culledMask = _mm256_movemask_ps(outside);
+            for (int lane = 0; lane < 8; lane++) {
+                uint8_t inside = (uint8_t)(((culledMask >> lane) & 1) ^ 1);
+                visibility[i + lane] = inside;
+                visible += inside;
+            }
+        }
+
+        return visible + CullRange(frustum, bounds, visibility, batchEnd, count);
+    }
+
+    const char* FrustumCuller::GetKernelName() { return "AVX2"; }
+
+#elif defined(CE_CULL_SSE)
+
+    size_t FrustumCuller::Cull(const Frustum& frustum, const BoundsSoA& bounds, uint8_t* visibility) {
+        const size_t count = bounds.Size();
+        const size_t batchEnd = count & ~(size_t)3;
+
+        __m128 nx[Frustum::Count], ny[Frustum::Count], nz[Frustum::Count], nd[Frustum::Count];
+        __m128 ax[Frustum::Count], ay[Frustum::Count], az[Frustum::Count];
+        for (int p = 0; p < Frustum::Count; p++) {
+            const Plane& plane = frustum.GetPlane((Frustum::Side)p);
+            nx[p] = _mm_set1_ps(plane.Normal.x);
+            ny[p] = _mm_set1_ps(plane.Normal.y);
+            nz[p] = _mm_set1_ps(plane.Normal.z);
+            nd[p] = _mm_set1_ps(plane.Distance);
+            ax[p] = _mm_set1_ps(std::fabs(plane.Normal.x));
+            ay[p] = _mm_set1_ps(std::fabs(plane.Normal.y));
+            az[p] = _mm_set1_ps(std::fabs(plane.Normal.z));
+        }
+        const __m128 zero = _mm_setzero_ps();
+
+        size_t visible = 0;
+        for (size_t i = 0; i < batchEnd; i += 4) {
+            __m128 cx = _mm_loadu_ps(&bounds.CenterX[i]);
+            __m128 cy = _mm_loadu_ps(&bounds.CenterY[i]);
+            __m128 cz = _mm_loadu_ps(&bounds.CenterZ[i]);
+            __m128 ex = _mm_loadu_ps(&bounds.ExtentX[i]);
+            __m128 ey = _mm_loadu_ps(&bounds.ExtentY[i]);
+            __m128 ez = _mm_loadu_ps(&bounds.ExtentZ[i]);
+
+            __m128 outside = zero;
+            for (int p = 0; p < Frustum::Count; p++) {
+                __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, nx[p]), _mm_mul_ps(cy, ny[p])),
+                                             _mm_add_ps(_mm_mul_ps(cz, nz[p]), nd[p]));
+                __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ex, ax[p]), _mm_mul_ps(ey, ay[p])), _mm_mul_ps(ez, az[p]));
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), zero));
+            }
+
+            int culledMask = _mm_movemask_ps(outside);
+            for (int lane = 0; lane < 4; lane++) {
+                uint8_t inside = (uint8_t)(((culledMask >> lane) & 1) ^ 1);
+                visibility[i + lane] = inside;
+                visible += inside;
+            }
+        }
+
+        return visible + CullRange(frustum, bounds, visibility, batchEnd, count);
+    }
+
+    const char* FrustumCuller::GetKernelName() { return "SSE"; }
+
+#else
+
+    size_t FrustumCuller::Cull(const Frustum& frustum, const BoundsSoA& bounds, uint8_t* visibility) {
+        return CullScalar(frustum, bounds, visibility);
+    }
+
+    const char* FrustumCuller::GetKernelName() { return "Scalar"; }
+
+#endif
+
+}
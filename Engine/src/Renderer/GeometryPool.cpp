@@ -0,0 +1,200 @@
+#include "ClaudeEngine/Renderer/GeometryPool.h"
+#include "ClaudeEngine/Renderer/Buffer.h"
+#include "ClaudeEngine/Renderer/Mesh.h"
+#include "ClaudeEngine/Core/Log.h"
+#include <algorithm>
+#include <vector>
+
+namespace ClaudeEngine {
+
+    namespace {
+
+        // Free ranges are kept sorted by offset and coalesced on release
+        struct FreeRange {
+            uint32_t Offset;
+            uint32_t Count;
+        };
+
+        // A released page has no VAO; its slot is reused so allocations keep their page index
+        struct GeometryPage {
+            Ref<VertexArray> VAO;
+            Ref<VertexBuffer> Vertices;
+            Ref<IndexBuffer> Indices;
+            VertexFormat Format = VertexFormat::Standard;
+            IndexType Indexing = IndexType::UInt32;
+            uint32_t VertexCapacity = 0;
+            uint32_t IndexCapacity = 0;
+            std::vector<FreeRange> FreeVertices;
+            std::vector<FreeRange> FreeIndices;
+        };
+
+        struct GeometryPoolData {
+            std::vector<GeometryPage> Pages;
+            GeometryPool::Statistics Stats;
+        };
+
+    }
+
+    static GeometryPoolData* s_PoolData = nullptr;
+
+    static int FindFreeRange(const std::vector<FreeRange>& ranges, uint32_t count) {
+        for (size_t i = 0; i < ranges.size(); i++) {
+            if (ranges[i].Count >= count)
+                return (int)i;
+        }
+        return -1;
+    }
+
+    static uint32_t TakeFreeRange(std::vector<FreeRange>& ranges, int index, uint32_t count) {
+        FreeRange& range = ranges[index];
+        uint32_t offset = range.Offset;
+        range.Offset += count;
+        range.Count -= count;
+        if (range.Count == 0)
+            ranges.erase(ranges.begin() + index);
+        return offset;
+    }
+
+    static void ReleaseRange(std::vector<FreeRange>& ranges, uint32_t offset, uint32_t count) {
+        auto it = std::lower_bound(ranges.begin(), ranges.end(), offset,
+            [](const FreeRange& range, uint32_t value) { return range.Offset < value; });
+        it = ranges.insert(it, { offset, count });
+
+        auto next = it + 1;
+        if (next != ranges.end() && it->Offset + it->Count == next->Offset) {
+            it->Count += next->Count;
+            ranges.erase(next);
+        }
+        if (it != ranges.begin()) {
+            auto prev = it - 1;
+            if (prev->Offset + prev->Count == it->Offset) {
+                prev->Count += it->Count;
+                ranges.erase(it);
+            }
+        }
+    }
+
+    static GeometryPage CreatePage(VertexFormat format, IndexType indexType, uint32_t vertexCapacity, uint32_t indexCapacity) {
+        GeometryPage page;
+        page.Format = format;
+        page.Indexing = indexType;
+        page.VertexCapacity = vertexCapacity;
+        page.IndexCapacity = indexCapacity;
+        page.FreeVertices.push_back({ 0, vertexCapacity });
+        page.FreeIndices.push_back({ 0, indexCapacity });
+
+        page.VAO = VertexArray::Create();
+        page.Vertices = VertexBuffer::Create(vertexCapacity * GetVertexFormatStride(format), BufferUsage::Dynamic);
+        page.Vertices->SetLayout(GetVertexFormatLayout(format));
+        page.VAO->AddVertexBuffer(page.Vertices);
+
+        page.Indices = IndexBuffer::Create(indexCapacity, indexType, BufferUsage::Dynamic);
+        page.VAO->SetIndexBuffer(page.Indices);
+        return page;
+    }
+
+    void GeometryPool::Init() {
+        s_PoolData = new GeometryPoolData();
+    }
+
+    void GeometryPool::Shutdown() {
+        delete s_PoolData;
+        s_PoolData = nullptr;
+    }
+
+    GeometryAllocation GeometryPool::Allocate(VertexFormat format, const void* vertices, uint32_t vertexCount,
+                                              const uint32_t* indices, uint32_t indexCount) {
+        CE_CORE_ASSERT(s_PoolData, "GeometryPool used before Renderer::Init!");
+
+        GeometryAllocation allocation;
+        if (vertexCount == 0 || indexCount == 0)
+            return allocation;
+
+        // Indices are mesh-local, so the vertex count alone decides whether 16 bits suffice
+        const IndexType indexType = vertexCount <= MaxShortIndexVertices ? IndexType::UInt16 : IndexType::UInt32;
+
+        auto& pages = s_PoolData->Pages;
+        int vertexRange = -1;
+        int indexRange = -1;
+        uint32_t pageIndex = 0;
+        for (; pageIndex < pages.size(); pageIndex++) {
+            if (!pages[pageIndex].VAO || pages[pageIndex].Format != format || pages[pageIndex].Indexing != indexType)
+                continue;
+            vertexRange = FindFreeRange(pages[pageIndex].FreeVertices, vertexCount);
+            indexRange = FindFreeRange(pages[pageIndex].FreeIndices, indexCount);
+            if (vertexRange >= 0 && indexRange >= 0)
+                break;
+        }
+
+        if (pageIndex == pages.size()) {
+            pageIndex = 0;
+            while (pageIndex < pages.size() && pages[pageIndex].VAO)
+                pageIndex++;
+            if (pageIndex == pages.size())
+                pages.emplace_back();
+            pages[pageIndex] = CreatePage(format, indexType, std::max(vertexCount, PageVertexCapacity), std::max(indexCount, PageIndexCapacity));
+            vertexRange = 0;
+            indexRange = 0;
+
+            auto& stats = s_PoolData->Stats;
+            stats.Pages++;
+            stats.VertexCapacity += pages[pageIndex].VertexCapacity;
+            stats.IndexCapacity += pages[pageIndex].IndexCapacity;
+        }
+
+        GeometryPage& page = pages[pageIndex];
+        allocation.Page = pageIndex;
+        allocation.VertexCount = vertexCount;
+        allocation.IndexCount = indexCount;
+        allocation.BaseVertex = TakeFreeRange(page.FreeVertices, vertexRange, vertexCount);
+        allocation.FirstIndex = TakeFreeRange(page.FreeIndices, indexRange, indexCount);
+
+        const uint32_t stride = GetVertexFormatStride(format);
+        page.Vertices->SetData(vertices, vertexCount * stride, allocation.BaseVertex * stride);
+        page.Indices->SetData(indices, indexCount, allocation.FirstIndex);
+
+        auto& stats = s_PoolData->Stats;
+        stats.Allocations++;
+        stats.UsedVertices += vertexCount;
+        stats.UsedVertexBytes += (uint64_t)vertexCount * stride;
+        stats.UsedIndexBytes += (uint64_t)indexCount * IndexTypeSize(indexType);
+        stats.UsedIndices += indexCount;
+        return allocation;
+    }
+
+    void GeometryPool::Free(const GeometryAllocation& allocation) {
+        // Meshes may outlive the renderer on shutdown
+        if (!s_PoolData || !allocation.IsValid())
+            return;
+
+        GeometryPage& page = s_PoolData->Pages[allocation.Page];
+        ReleaseRange(page.FreeVertices, allocation.BaseVertex, allocation.VertexCount);
+        ReleaseRange(page.FreeIndices, allocation.FirstIndex, allocation.IndexCount);
+
+        auto& stats = s_PoolData->Stats;
+        stats.Allocations--;
+        stats.UsedVertices -= allocation.VertexCount;
+        stats.UsedVertexBytes -= (uint64_t)allocation.VertexCount * GetVertexFormatStride(page.Format);
+        stats.UsedIndexBytes -= (uint64_t)allocation.IndexCount * IndexTypeSize(page.Indexing);
+        stats.UsedIndices -= allocation.IndexCount;
+
+        // Release the GPU buffers of a page nothing lives in any more
+        const bool empty = page.FreeVertices.size() == 1 && page.FreeVertices[0].Count == page.VertexCapacity &&
+                           page.FreeIndices.size() == 1 && page.FreeIndices[0].Count == page.IndexCapacity;
+        if (empty) {
+            stats.Pages--;
+            stats.VertexCapacity -= page.VertexCapacity;
+            stats.IndexCapacity -= page.IndexCapacity;
+            page = GeometryPage();
+        }
+    }
+
+    const Ref<VertexArray>& GeometryPool::GetVertexArray(uint32_t page) {
+        return s_PoolData->Pages[page].VAO;
+    }
+
+    GeometryPool::Statistics GeometryPool::GetStats() {
+        return s_PoolData ? s_PoolData->Stats : Statistics();
+    }
+
+}
@@ -0,0 +1,28 @@
+#include "ClaudeEngine/Renderer/LODSelector.h"
+#include <algorithm>
+
+namespace ClaudeEngine {
+
+    float LODSelector::ComputeScreenSize(const AABB& worldBounds, const glm::vec3& cameraPosition, const glm::mat4& projection) {
+        float radius = glm::length(worldBounds.GetExtents());
+        float distance = glm::length(worldBounds.GetCenter() - cameraPosition);
+        // Camera inside the sphere
+        if (distance <= radius)
+            return 1.0f;
+        // projection[1][1] is cot(fovy / 2): diameter over the frustum height at that distance
+        return radius * projection[1][1] / distance;
+    }
+
+    uint32_t LODSelector::Select(float screenSize, uint32_t current, uint32_t levelCount) {
+        if (levelCount <= 1)
+            return 0;
+
+        uint32_t level = std::min(current, levelCount - 1);
+        while (level + 1 < levelCount && screenSize < GetThreshold(level + 1) * (1.0f - Hysteresis))
+            level++;
+        while (level > 0 && screenSize > GetThreshold(level) * (1.0f + Hysteresis))
+            level--;
+        return level;
+    }
+
+}
@@ -1,5 +1,7 @@
 #include "ClaudeEngine/Renderer/Material.h"
+#include "ClaudeEngine/Renderer/Renderer.h"
 #include "ClaudeEngine/Core/Log.h"
+#include <algorithm>
 
 namespace ClaudeEngine {
 
@@ -7,77 +9,141 @@ namespace ClaudeEngine {
         : m_Name(name), m_Workflow(workflow) {
     }
 
+    template<typename T>
+    void Material::SetProperty(std::vector<Property<T>>& properties, const std::string& name, const T& value) {
+        UniformHandle handle = Shader::GetUniformHandle(name);
+        for (auto& property : properties) {
+            if (property.Handle == handle) {
+                property.Value = value;
+                return;
+            }
+        }
+        properties.push_back({ handle, value });
+    }
+
     void Material::SetFloat(const std::string& name, float value) {
-        m_FloatProperties[name] = value;
+        SetProperty(m_FloatProperties, name, value);
     }
 
     void Material::SetVec3(const std::string& name, const glm::vec3& value) {
-        m_Vec3Properties[name] = value;
+        SetProperty(m_Vec3Properties, name, value);
     }
 
     void Material::SetVec4(const std::string& name, const glm::vec4& value) {
-        m_Vec4Properties[name] = value;
+        SetProperty(m_Vec4Properties, name, value);
     }
 
     void Material::SetTexture(const std::string& name, const Ref<Texture2D>& texture) {
-        m_TextureProperties[name] = texture;
+        SetProperty(m_TextureProperties, name, texture);
     }
 
-    void Material::Bind() {
-        if (!m_Shader) {
-            CE_CORE_WARN("Material '", m_Name, "' has no shader!");
+    void Material::SetKeyword(const std::string& keyword, bool enabled) {
+        auto it = std::find(m_Keywords.begin(), m_Keywords.end(), keyword);
+        if (enabled == (it != m_Keywords.end()))
             return;
-        }
 
-        m_Shader->Bind();
-
-        // Bind ray tracing properties
-        auto& rt = m_RTProperties;
-        m_Shader->SetFloat3("u_Material.Albedo", rt.Albedo);
-        m_Shader->SetFloat("u_Material.Metallic", rt.Metallic);
-        m_Shader->SetFloat("u_Material.Roughness", rt.Roughness);
-        m_Shader->SetFloat("u_Material.AO", rt.AOStrength);
-        m_Shader->SetFloat3("u_Material.Emission", rt.Emission);
-        m_Shader->SetFloat("u_Material.EmissionStrength", rt.EmissionStrength);
-        m_Shader->SetFloat("u_Material.IOR", rt.IOR);
-        m_Shader->SetFloat("u_Material.Transmission", rt.Transmission);
-
-        // Bind textures
-        int textureSlot = 0;
-        if (rt.AlbedoMap) {
-            rt.AlbedoMap->Bind(textureSlot);
-            m_Shader->SetInt("u_AlbedoMap", textureSlot++);
-            m_Shader->SetInt("u_UseAlbedoMap", 1);
-        } else {
-            m_Shader->SetInt("u_UseAlbedoMap", 0);
-        }
+        if (enabled)
+            m_Keywords.push_back(keyword);
+        else
+            m_Keywords.erase(it);
+        m_VariantDirty = true;
+    }
 
-        if (rt.NormalMap) {
-            rt.NormalMap->Bind(textureSlot);
-            m_Shader->SetInt("u_NormalMap", textureSlot++);
-            m_Shader->SetInt("u_UseNormalMap", 1);
-        } else {
-            m_Shader->SetInt("u_UseNormalMap", 0);
-        }
+    bool Material::IsKeywordEnabled(const std::string& keyword) const {
+        return std::find(m_Keywords.begin(), m_Keywords.end(), keyword) != m_Keywords.end();
+    }
 
-        if (rt.MetallicRoughnessMap) {
-            rt.MetallicRoughnessMap->Bind(textureSlot);
-            m_Shader->SetInt("u_MetallicRoughnessMap", textureSlot++);
-            m_Shader->SetInt("u_UseMetallicRoughnessMap", 1);
-        } else {
-            m_Shader->SetInt("u_UseMetallicRoughnessMap", 0);
-        }
+    Shader* Material::GetVariant() {
+        if (!m_Shader)
+            return nullptr;
+        if (!m_VariantDirty)
+            return m_Variant;
+
+        // Undeclared keywords map to no bit, so shaders without features always resolve to themselves
+        const auto& rt = m_RTProperties;
+        ShaderFeatureMask features = 0;
+        if (rt.AlbedoMap)
+            features |= m_Shader->GetFeatureMask("ALBEDO_MAP");
+        if (rt.NormalMap)
+            features |= m_Shader->GetFeatureMask("NORMAL_MAP");
+        if (rt.MetallicRoughnessMap)
+            features |= m_Shader->GetFeatureMask("METALLIC_ROUGHNESS_MAP");
+        if (rt.AOMap)
+            features |= m_Shader->GetFeatureMask("AO_MAP");
+        if (rt.EmissionMap)
+            features |= m_Shader->GetFeatureMask("EMISSION_MAP");
+        for (const auto& keyword : m_Keywords)
+            features |= m_Shader->GetFeatureMask(keyword);
+
+        m_Variant = m_Shader->GetVariant(features);
+        m_VariantDirty = false;
+        return m_Variant;
+    }
 
-        // Bind generic properties
-        for (const auto& [name, value] : m_FloatProperties) {
-            m_Shader->SetFloat(name, value);
-        }
-        for (const auto& [name, value] : m_Vec3Properties) {
-            m_Shader->SetFloat3(name, value);
+    void Material::UploadParameters() {
+        // Created on first bind so materials can be built before the GL context exists
+        if (!m_ParameterBuffer)
+            m_ParameterBuffer = UniformBuffer::Create(sizeof(MaterialParameters), MaterialBinding);
+
+        const auto& rt = m_RTProperties;
+        MaterialParameters parameters = {};
+        parameters.Albedo = rt.Albedo;
+        parameters.Metallic = rt.Metallic;
+        parameters.Emission = rt.Emission;
+        parameters.EmissionStrength = rt.EmissionStrength;
+        parameters.Roughness = rt.Roughness;
+        parameters.AO = rt.AOStrength;
+        parameters.IOR = rt.IOR;
+        parameters.Transmission = rt.Transmission;
+        parameters.NormalStrength = rt.NormalStrength;
+        parameters.UseAlbedoMap = rt.AlbedoMap ? 1 : 0;
+        parameters.UseNormalMap = rt.NormalMap ? 1 : 0;
+        parameters.UseMetallicRoughnessMap = rt.MetallicRoughnessMap ? 1 : 0;
+        parameters.UseAOMap = rt.AOMap ? 1 : 0;
+        parameters.UseEmissionMap = rt.EmissionMap ? 1 : 0;
+
+        m_ParameterBuffer->SetData(&parameters, sizeof(MaterialParameters));
+        m_ParametersDirty = false;
+    }
+
+    void Material::Bind() {
+        if (!m_Shader) {
+            CE_CORE_WARN("Material '", m_Name, "' has no shader!");
+            return;
         }
-        for (const auto& [name, value] : m_Vec4Properties) {
-            m_Shader->SetFloat4(name, value);
+
+        Shader* shader = GetVariant();
+        shader->Bind();
+
+        if (m_ParametersDirty)
+            UploadParameters();
+        m_ParameterBuffer->Bind();
+
+        // Samplers are bound to fixed units in the shaders, so only the textures move
+        const auto& rt = m_RTProperties;
+        if (rt.AlbedoMap)
+            rt.AlbedoMap->Bind(AlbedoSlot);
+        if (rt.NormalMap)
+            rt.NormalMap->Bind(NormalSlot);
+        if (rt.MetallicRoughnessMap)
+            rt.MetallicRoughnessMap->Bind(MetallicRoughnessSlot);
+        if (rt.AOMap)
+            rt.AOMap->Bind(AOSlot);
+        if (rt.EmissionMap)
+            rt.EmissionMap->Bind(EmissionSlot);
+
+        // Generic properties are program state shared with other materials, so they are re-applied
+        uint32_t textureSlot = FirstGenericSlot;
+        for (const auto& texture : m_TextureProperties) {
+            texture.Value->Bind(textureSlot);
+            shader->SetInt(texture.Handle, (int)textureSlot++);
         }
+        for (const auto& property : m_FloatProperties)
+            shader->SetFloat(property.Handle, property.Value);
+        for (const auto& property : m_Vec3Properties)
+            shader->SetFloat3(property.Handle, property.Value);
+        for (const auto& property : m_Vec4Properties)
+            shader->SetFloat4(property.Handle, property.Value);
     }
 
     void Material::Unbind() {
@@ -109,20 +175,22 @@ namespace ClaudeEngine {
 
     Ref<Material> MaterialLibrary::CreateDefaultPBR() {
         auto material = CreateRef<Material>("Default PBR", MaterialWorkflow::PBR_MetallicRoughness);
-        auto& rt = material->GetRTProperties();
+        RayTracingProperties rt;
         rt.Albedo = { 0.8f, 0.8f, 0.8f };
         rt.Metallic = 0.0f;
         rt.Roughness = 0.5f;
+        material->SetRTProperties(rt);
         return material;
     }
 
     Ref<Material> MaterialLibrary::CreateDefaultRayTracing() {
         auto material = CreateRef<Material>("Default RT", MaterialWorkflow::RayTracing);
-        auto& rt = material->GetRTProperties();
+        RayTracingProperties rt;
         rt.Albedo = { 0.8f, 0.8f, 0.8f };
         rt.Metallic = 0.0f;
         rt.Roughness = 0.5f;
         rt.IOR = 1.45f;
+        material->SetRTProperties(rt);
         return material;
     }
 
@@ -1,34 +1,47 @@
 #include "ClaudeEngine/Renderer/Mesh.h"
 #include "ClaudeEngine/Renderer/RenderCommand.h"
+#include "ClaudeEngine/Renderer/TriangleBVH.h"
 
 namespace ClaudeEngine {
 
     Mesh::Mesh(const std::vector<Vertex>& vertices, 
                const std::vector<uint32_t>& indices,
-               const std::vector<MeshTexture>& textures)
-        : m_Vertices(vertices), m_Indices(indices), m_Textures(textures) {
-        SetupMesh();
-    }
+               const std::vector<MeshTexture>& textures,
+               const std::vector<std::vector<uint32_t>>& lodIndices,
+               VertexFormat format,
+               const std::vector<Meshlet>& meshlets)
+        : m_Vertices(vertices), m_Indices(indices), m_Textures(textures), m_Meshlets(meshlets), m_Format(format) {
+        for (const auto& vertex : m_Vertices)
+            m_BoundingBox.Expand(vertex.Position);
 
-    void Mesh::SetupMesh() {
-        m_VertexArray = VertexArray::Create();
+        SetupMesh(lodIndices);
+    }
 
-        m_VertexBuffer = VertexBuffer::Create((float*)m_Vertices.data(), 
-                                               m_Vertices.size() * sizeof(Vertex));
+    Mesh::~Mesh() {
+        GeometryPool::Free(m_Geometry);
+    }
 
-        m_VertexBuffer->SetLayout({
-            { ShaderDataType::Float3, "a_Position" },
-            { ShaderDataType::Float3, "a_Normal" },
-            { ShaderDataType::Float2, "a_TexCoords" },
-            { ShaderDataType::Float3, "a_Tangent" },
-            { ShaderDataType::Float3, "a_Bitangent" }
-        });
+    const TriangleBVH& Mesh::GetTriangleBVH() const {
+        if (!m_TriangleBVH)
+            m_TriangleBVH = CreateScope<TriangleBVH>(m_Vertices, m_Indices);
+        return *m_TriangleBVH;
+    }
 
-        m_VertexArray->AddVertexBuffer(m_VertexBuffer);
+    void Mesh::SetupMesh(const std::vector<std::vector<uint32_t>>& lodIndices) {
+        // Every level indexes the same vertices, so they share one allocation back to back
+        std::vector<uint32_t> allIndices = m_Indices;
+        m_LODs.push_back({ 0, (uint32_t)m_Indices.size() });
+        for (const auto& lod : lodIndices) {
+            m_LODs.push_back({ (uint32_t)allIndices.size(), (uint32_t)lod.size() });
+            allIndices.insert(allIndices.end(), lod.begin(), lod.end());
+        }
 
-        m_IndexBuffer = IndexBuffer::Create((uint32_t*)m_Indices.data(), 
-                                             m_Indices.size());
-        m_VertexArray->SetIndexBuffer(m_IndexBuffer);
+        std::vector<uint8_t> packed;
+        m_DequantizeTransform = PackVertices(m_Vertices, m_Format, packed);
+        m_Geometry = GeometryPool::Allocate(m_Format, packed.data(), (uint32_t)m_Vertices.size(),
+                                            allIndices.data(), (uint32_t)allIndices.size());
+        if (m_Geometry.IsValid())
+            m_VertexArray = GeometryPool::GetVertexArray(m_Geometry.Page);
     }
 
     void Mesh::Draw(const Ref<Shader>& shader) {
@@ -53,8 +66,14 @@ namespace ClaudeEngine {
             m_Textures[i].Texture->Bind(i);
         }
 
+        if (!m_VertexArray)
+            return;
+
+        // Quantized positions additionally need GetDequantizeTransform in the caller's model matrix
+        static const UniformHandle vertexFormatHandle = Shader::GetUniformHandle("u_VertexFormat");
+        shader->SetInt(vertexFormatHandle, (int)m_Format);
         m_VertexArray->Bind();
-        RenderCommand::DrawIndexed(m_VertexArray);
+        RenderCommand::DrawIndexed(m_VertexArray, GetIndexCount(), GetFirstIndex(), GetBaseVertex());
     }
 
 }
@@ -0,0 +1,274 @@
+#include "ClaudeEngine/Renderer/MeshOptimizer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ClaudeEngine {
+
+    namespace {
+
+        constexpr uint32_t InvalidIndex = ~0u;
+
+        // Forsyth's scoring: recently used vertices and vertices with few triangles left win
+        constexpr uint32_t ScoringCacheSize = 32;
+        constexpr float CacheDecayPower = 1.5f;
+        constexpr float LastTriangleScore = 0.75f;
+        constexpr float ValenceBoostScale = 2.0f;
+        constexpr float ValenceBoostPower = 0.5f;
+
+        float VertexScore(int cachePosition, uint32_t remainingTriangles) {
+            if (remainingTriangles == 0)
+                return -1.0f;
+
+            float score = 0.0f;
+            if (cachePosition >= 0) {
+                // The last triangle's vertices get a fixed score so the next one does not just reuse an edge
+                if (cachePosition < 3) {
+                    score = LastTriangleScore;
+                } else {
+                    float scaler = 1.0f / (ScoringCacheSize - 3);
+                    score = std::pow(1.0f - (cachePosition - 3) * scaler, CacheDecayPower);
+                }
+            }
+            return score + ValenceBoostScale * std::pow((float)remainingTriangles, -ValenceBoostPower);
+        }
+
+        // FIFO cache over the triangles [first, last); returns the number of misses
+        uint32_t CountMisses(const std::vector<uint32_t>& indices, size_t first, size_t last, uint32_t cacheSize,
+                             std::vector<uint32_t>& timestamps, uint32_t& time) {
+            uint32_t misses = 0;
+            for (size_t i = first * 3; i < last * 3; i++) {
+                uint32_t index = indices[i];
+                // Entries older than cacheSize insertions have been pushed out
+                if (time - timestamps[index] > cacheSize) {
+                    timestamps[index] = time++;
+                    misses++;
+                }
+            }
+            return misses;
+        }
+
+    }
+
+    MeshOptimizer::CacheStatistics MeshOptimizer::AnalyzeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount, uint32_t cacheSize) {
+        CacheStatistics stats;
+        stats.Triangles = (uint32_t)(indices.size() / 3);
+        if (stats.Triangles == 0)
+            return stats;
+
+        std::vector<uint32_t> timestamps(vertexCount, 0);
+        uint32_t time = cacheSize + 1;
+        stats.Misses = CountMisses(indices, 0, stats.Triangles, cacheSize, timestamps, time);
+
+        std::vector<uint8_t> referenced(vertexCount, 0);
+        uint32_t uniqueVertices = 0;
+        for (uint32_t index : indices) {
+            uniqueVertices += referenced[index] ? 0 : 1;
+            referenced[index] = 1;
+        }
+
+        stats.ACMR = (float)stats.Misses / stats.Triangles;
+        stats.ATVR = uniqueVertices ? (float)stats.Misses / uniqueVertices : 0.0f;
+        return stats;
+    }
+
+    void MeshOptimizer::OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertexCount) {
+        const uint32_t triangleCount = (uint32_t)(indices.size() / 3);
+        if (triangleCount == 0)
+            return;
+
+        // Triangles per vertex; each vertex's list shrinks as its triangles are emitted
+        std::vector<uint32_t> remaining(vertexCount, 0);
+        for (uint32_t index : indices)
+            remaining[index]++;
+        std::vector<uint32_t> offsets(vertexCount + 1, 0);
+        for (uint32_t i = 0; i < vertexCount; i++)
+            offsets[i + 1] = offsets[i] + remaining[i];
+        std::vector<uint32_t> adjacency(indices.size());
+        {
+            std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+            for (uint32_t i = 0; i < (uint32_t)indices.size(); i++)
+                adjacency[cursor[indices[i]]++] = i / 3;
+        }
+
+        std::vector<int> cachePosition(vertexCount, -1);
+        std::vector<float> vertexScores(vertexCount);
+        for (uint32_t i = 0; i < vertexCount; i++)
+            vertexScores[i] = VertexScore(-1, remaining[i]);
+
+        std::vector<float> triangleScores(triangleCount);
+        std::vector<uint8_t> emitted(triangleCount, 0);
+        uint32_t best = 0;
+        for (uint32_t t = 0; t < triangleCount; t++) {
+            triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+            if (triangleScores[t] > triangleScores[best])
+                best = t;
+        }
+
+        std::vector<uint32_t> output;
+        output.reserve(indices.size());
+        std::vector<uint32_t> cache, nextCache;
+        cache.reserve(ScoringCacheSize + 3);
+        nextCache.reserve(ScoringCacheSize + 3);
+        uint32_t scanCursor = 0;
+
+        while (output.size() < indices.size()) {
+            if (best == InvalidIndex) {
+                // Nothing in the cache has triangles left: continue with the next unemitted one
+                while (emitted[scanCursor])
+                    scanCursor++;
+                best = scanCursor;
+            }
+
+            emitted[best] = 1;
+            const uint32_t corners[3] = { indices[best * 3], indices[best * 3 + 1], indices[best * 3 + 2] };
+            nextCache.clear();
+            for (uint32_t vertex : corners) {
+                output.push_back(vertex);
+                nextCache.push_back(vertex);
+
+                uint32_t* begin = adjacency.data() + offsets[vertex];
+                uint32_t* end = begin + remaining[vertex];
+                std::iter_swap(std::find(begin, end, best), end - 1);
+                remaining[vertex]--;
+            }
+
+            for (uint32_t vertex : cache) {
+                if (vertex != corners[0] && vertex != corners[1] && vertex != corners[2])
+                    nextCache.push_back(vertex);
+            }
+            // Evicted vertices still need their scores lowered
+            for (size_t i = ScoringCacheSize; i < nextCache.size(); i++)
+                cachePosition[nextCache[i]] = -1;
+            std::swap(cache, nextCache);
+
+            best = InvalidIndex;
+            float bestScore = -1.0f;
+            for (size_t i = 0; i < cache.size(); i++) {
+                uint32_t vertex = cache[i];
+                int position = i < ScoringCacheSize ? (int)i : -1;
+                cachePosition[vertex] = position;
+
+                float score = VertexScore(position, remaining[vertex]);
+                float delta = score - vertexScores[vertex];
+                vertexScores[vertex] = score;
+
+                for (uint32_t j = 0; j < remaining[vertex]; j++) {
+                    uint32_t triangle = adjacency[offsets[vertex] + j];
+                    triangleScores[triangle] += delta;
+                    if (triangleScores[triangle] > bestScore) {
+                        bestScore = triangleScores[triangle];
+                        best = triangle;
+                    }
+                }
+            }
+            if (cache.size() > ScoringCacheSize)
+                cache.resize(ScoringCacheSize);
+        }
+
+        indices.swap(output);
+    }
+
+    void MeshOptimizer::OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, float threshold) {
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount < 2)
+            return;
+
+        constexpr uint32_t CacheSize = 16;
+        std::vector<uint32_t> timestamps(vertices.size(), 0);
+        uint32_t time = CacheSize + 1;
+
+        // Hard boundaries: triangles where the cache restarted from scratch
+        std::vector<size_t> hardClusters;
+        for (size_t t = 0; t < triangleCount; t++) {
+            if (CountMisses(indices, t, t + 1, CacheSize, timestamps, time) == 3)
+                hardClusters.push_back(t);
+        }
+        hardClusters.push_back(triangleCount);
+
+        // Soft boundaries: cut inside a hard cluster wherever the cache would still do well enough
+        // if it started over, which gives the sort more freedom
+        std::vector<size_t> clusters;
+        for (size_t c = 0; c + 1 < hardClusters.size(); c++) {
+            size_t start = hardClusters[c], end = hardClusters[c + 1];
+            time += CacheSize + 1;
+            float clusterACMR = (float)CountMisses(indices, start, end, CacheSize, timestamps, time) / (end - start);
+
+            time += CacheSize + 1;
+            uint32_t misses = 0;
+            clusters.push_back(start);
+            size_t clusterStart = start;
+            for (size_t t = start; t < end; t++) {
+                misses += CountMisses(indices, t, t + 1, CacheSize, timestamps, time);
+                size_t clusterSize = t + 1 - clusterStart;
+                if (t + 1 < end && (float)misses / clusterSize <= threshold * clusterACMR) {
+                    clusters.push_back(t + 1);
+                    clusterStart = t + 1;
+                    misses = 0;
+                    time += CacheSize + 1;
+                }
+            }
+        }
+        clusters.push_back(triangleCount);
+        if (clusters.size() <= 2)
+            return;
+
+        // Area-weighted centroid and normal per cluster
+        glm::vec3 meshCentroid(0.0f);
+        float meshArea = 0.0f;
+        const size_t clusterCount = clusters.size() - 1;
+        std::vector<float> sortKeys(clusterCount);
+        std::vector<glm::vec3> centroids(clusterCount), normals(clusterCount);
+        for (size_t c = 0; c < clusterCount; c++) {
+            glm::vec3 centroid(0.0f), normal(0.0f);
+            float area = 0.0f;
+            for (size_t t = clusters[c]; t < clusters[c + 1]; t++) {
+                const glm::vec3& p0 = vertices[indices[t * 3]].Position;
+                const glm::vec3& p1 = vertices[indices[t * 3 + 1]].Position;
+                const glm::vec3& p2 = vertices[indices[t * 3 + 2]].Position;
+                glm::vec3 cross = glm::cross(p1 - p0, p2 - p0);
+                float triangleArea = glm::length(cross);
+                centroid += (p0 + p1 + p2) * (triangleArea / 3.0f);
+                normal += cross;
+                area += triangleArea;
+            }
+
+            meshCentroid += centroid;
+            meshArea += area;
+            centroids[c] = area > 0.0f ? centroid / area : centroid;
+            float normalLength = glm::length(normal);
+            normals[c] = normalLength > 0.0f ? normal / normalLength : normal;
+        }
+        if (meshArea > 0.0f)
+            meshCentroid = meshCentroid / meshArea;
+
+        for (size_t c = 0; c < clusterCount; c++)
+            sortKeys[c] = glm::dot(centroids[c] - meshCentroid, normals[c]);
+
+        std::vector<uint32_t> order(clusterCount);
+        for (uint32_t c = 0; c < (uint32_t)clusterCount; c++)
+            order[c] = c;
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return sortKeys[a] > sortKeys[b]; });
+
+        std::vector<uint32_t> output;
+        output.reserve(indices.size());
+        for (uint32_t c : order)
+            output.insert(output.end(), indices.begin() + clusters[c] * 3, indices.begin() + clusters[c + 1] * 3);
+        indices.swap(output);
+    }
+
+    void MeshOptimizer::OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+        std::vector<uint32_t> remap(vertices.size(), InvalidIndex);
+        std::vector<Vertex> reordered;
+        reordered.reserve(vertices.size());
+
+        for (uint32_t& index : indices) {
+            if (remap[index] == InvalidIndex) {
+                remap[index] = (uint32_t)reordered.size();
+                reordered.push_back(vertices[index]);
+            }
+            index = remap[index];
+        }
+        vertices.swap(reordered);
+    }
+
+}
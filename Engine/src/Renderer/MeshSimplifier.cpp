@@ -0,0 +1,562 @@
+#include "ClaudeEngine/Renderer/MeshSimplifier.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+namespace ClaudeEngine {
+
+    namespace {
+
+        constexpr uint32_t InvalidIndex = ~0u;
+        constexpr uint32_t MultipleEdges = ~1u;
+
+        // Symmetric 4x4 error matrix stored as its upper triangle, plus the accumulated weight
+        struct Quadric {
+            double A00 = 0, A01 = 0, A02 = 0, A03 = 0;
+            double A11 = 0, A12 = 0, A13 = 0;
+            double A22 = 0, A23 = 0;
+            double A33 = 0;
+            double Weight = 0;
+
+            void AddPlane(double a, double b, double c, double d, double weight) {
+                A00 += weight * a * a; A01 += weight * a * b; A02 += weight * a * c; A03 += weight * a * d;
+                A11 += weight * b * b; A12 += weight * b * c; A13 += weight * b * d;
+                A22 += weight * c * c; A23 += weight * c * d;
+                A33 += weight * d * d;
+                Weight += weight;
+            }
+
+            void Add(const Quadric& other) {
+                A00 += other.A00; A01 += other.A01; A02 += other.A02; A03 += other.A03;
+                A11 += other.A11; A12 += other.A12; A13 += other.A13;
+                A22 += other.A22; A23 += other.A23;
+                A33 += other.A33;
+                Weight += other.Weight;
+            }
+
+            // Weighted mean squared distance from p to the accumulated planes
+            double Error(const glm::vec3& p) const {
+                double x = p.x, y = p.y, z = p.z;
+                double result = A00 * x * x + 2.0 * A01 * x * y + 2.0 * A02 * x * z + 2.0 * A03 * x
+                              + A11 * y * y + 2.0 * A12 * y * z + 2.0 * A13 * y
+                              + A22 * z * z + 2.0 * A23 * z
+                              + A33;
+                return Weight > 0.0 ? std::fabs(result) / Weight : 0.0;
+            }
+        };
+
+        enum class VertexKind : uint8_t {
+            Manifold, // Interior with one attribute set; collapses onto any neighbour
+            Border,   // On an open edge; only slides along the border
+            Seam,     // Two attribute sets; slides along the seam, both sides together
+            Locked    // Seam ends, corners and anything non-manifold
+        };
+
+        struct Collapse {
+            uint32_t Source = 0;
+            uint32_t Target = 0;
+            // Other side of a seam; InvalidIndex otherwise
+            uint32_t SiblingSource = InvalidIndex;
+            uint32_t SiblingTarget = InvalidIndex;
+            double Error = 0.0;
+        };
+
+        // Triangles around each vertex, rebuilt after every pass
+        struct VertexTriangles {
+            std::vector<uint32_t> Offsets;
+            std::vector<uint32_t> Triangles;
+
+            void Build(const std::vector<uint32_t>& indices, size_t vertexCount) {
+                Offsets.assign(vertexCount + 1, 0);
+                for (uint32_t index : indices)
+                    Offsets[index + 1]++;
+                for (size_t i = 0; i < vertexCount; i++)
+                    Offsets[i + 1] += Offsets[i];
+
+                Triangles.resize(indices.size());
+                std::vector<uint32_t> cursor(Offsets.begin(), Offsets.end() - 1);
+                for (size_t i = 0; i < indices.size(); i++)
+                    Triangles[cursor[indices[i]]++] = (uint32_t)(i / 3);
+            }
+        };
+
+        class Simplifier {
+        public:
+            Simplifier(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
+                : m_Indices(indices) {
+                const size_t vertexCount = vertices.size();
+
+                // Work in a unit cube so errors are relative to the mesh extent
+                glm::vec3 min = vertices[indices[0]].Position, max = min;
+                for (uint32_t index : indices) {
+                    min = glm::min(min, vertices[index].Position);
+                    max = glm::max(max, vertices[index].Position);
+                }
+                glm::vec3 size = max - min;
+                float extent = std::max(std::max(size.x, size.y), size.z);
+                float scale = extent > 0.0f ? 1.0f / extent : 0.0f;
+
+                m_Positions.resize(vertexCount);
+                for (size_t i = 0; i < vertexCount; i++)
+                    m_Positions[i] = (vertices[i].Position - min) * scale;
+
+                BuildWedges();
+                m_Adjacency.Build(m_Indices, vertexCount);
+                ClassifyVertices();
+                BuildQuadrics();
+
+                m_Remap.resize(vertexCount);
+                m_Locked.resize(vertexCount);
+            }
+
+            std::vector<uint32_t> Run(size_t targetIndexCount, float targetError, float* resultError) {
+                const double errorLimit = (double)targetError * targetError;
+                size_t triangleCount = m_Indices.size() / 3;
+                double maxError = 0.0;
+
+                std::vector<Collapse> candidates;
+                while (triangleCount * 3 > targetIndexCount) {
+                    FindOpenEdges();
+                    GatherCollapses(candidates);
+                    if (candidates.empty())
+                        break;
+                    std::sort(candidates.begin(), candidates.end(),
+                              [](const Collapse& a, const Collapse& b) { return a.Error < b.Error; });
+
+                    for (size_t i = 0; i < m_Remap.size(); i++)
+                        m_Remap[i] = (uint32_t)i;
+                    std::fill(m_Locked.begin(), m_Locked.end(), (uint8_t)0);
+
+                    size_t collapsed = 0;
+                    for (const Collapse& collapse : candidates) {
+                        if (triangleCount * 3 <= targetIndexCount || collapse.Error > errorLimit)
+                            break;
+
+                        uint32_t source = m_Canonical[collapse.Source];
+                        uint32_t target = m_Canonical[collapse.Target];
+                        if (m_Locked[source] || m_Locked[target])
+                            continue;
+
+                        uint32_t removed = 0;
+                        if (!CanCollapse(collapse, removed))
+                            continue;
+
+                        m_Remap[collapse.Source] = collapse.Target;
+                        if (collapse.SiblingSource != InvalidIndex)
+                            m_Remap[collapse.SiblingSource] = collapse.SiblingTarget;
+                        m_Quadrics[target].Add(m_Quadrics[source]);
+                        maxError = std::max(maxError, collapse.Error);
+
+                        // Everything whose fan changed sits out the rest of the pass
+                        LockRing(collapse.Source);
+                        if (collapse.SiblingSource != InvalidIndex)
+                            LockRing(collapse.SiblingSource);
+                        m_Locked[target] = 1;
+
+                        triangleCount -= std::min<size_t>(removed, triangleCount);
+                        collapsed++;
+                    }
+
+                    if (collapsed == 0)
+                        break;
+                    ApplyRemap();
+                    triangleCount = m_Indices.size() / 3;
+                    m_Adjacency.Build(m_Indices, m_Positions.size());
+                }
+
+                if (resultError)
+                    *resultError = (float)std::sqrt(maxError);
+                return m_Indices;
+            }
+
+        private:
+            uint32_t Corner(uint32_t triangle, uint32_t corner) const { return m_Indices[triangle * 3 + corner]; }
+
+            // Whether the directed edge from -> to exists in some triangle
+            bool HasEdge(uint32_t from, uint32_t to) const {
+                for (uint32_t i = m_Adjacency.Offsets[from]; i < m_Adjacency.Offsets[from + 1]; i++) {
+                    uint32_t triangle = m_Adjacency.Triangles[i];
+                    for (uint32_t k = 0; k < 3; k++)
+                        if (Corner(triangle, k) == from && Corner(triangle, (k + 1) % 3) == to)
+                            return true;
+                }
+                return false;
+            }
+
+            // Same, ignoring attribute splits
+            bool HasWeldedEdge(uint32_t from, uint32_t to) const {
+                uint32_t a = from;
+                do {
+                    uint32_t b = to;
+                    do {
+                        if (HasEdge(a, b))
+                            return true;
+                        b = m_NextWedge[b];
+                    } while (b != to);
+                    a = m_NextWedge[a];
+                } while (a != from);
+                return false;
+            }
+
+            // Vertices sharing a position form a ring; the first one found stands in for all of them
+            void BuildWedges() {
+                struct PositionHash {
+                    size_t operator()(const glm::vec3& p) const {
+                        uint32_t bits[3];
+                        std::memcpy(bits, &p.x, sizeof(float));
+                        std::memcpy(bits + 1, &p.y, sizeof(float));
+                        std::memcpy(bits + 2, &p.z, sizeof(float));
+                        return (size_t)(bits[0] * 73856093u ^ bits[1] * 19349663u ^ bits[2] * 83492791u);
+                    }
+                };
+                struct PositionEqual {
+                    bool operator()(const glm::vec3& a, const glm::vec3& b) const {
+                        return a.x == b.x && a.y == b.y && a.z == b.z;
+                    }
+                };
+
+                const size_t vertexCount = m_Positions.size();
+                std::unordered_map<glm::vec3, uint32_t, PositionHash, PositionEqual> first;
+                first.reserve(vertexCount);
+                m_Canonical.resize(vertexCount);
+                m_NextWedge.resize(vertexCount);
+                for (uint32_t i = 0; i < (uint32_t)vertexCount; i++) {
+                    auto [it, inserted] = first.emplace(m_Positions[i], i);
+                    m_Canonical[i] = it->second;
+                    if (inserted) {
+                        m_NextWedge[i] = i;
+                    } else {
+                        m_NextWedge[i] = m_NextWedge[it->second];
+                        m_NextWedge[it->second] = i;
+                    }
+                }
+            }
+
+            void ClassifyVertices() {
+                const size_t vertexCount = m_Positions.size();
+                std::vector<uint32_t> openOut(vertexCount, 0), openIn(vertexCount, 0), weldedOpen(vertexCount, 0);
+
+                for (uint32_t triangle = 0; triangle < (uint32_t)(m_Indices.size() / 3); triangle++) {
+                    for (uint32_t k = 0; k < 3; k++) {
+                        uint32_t a = Corner(triangle, k), b = Corner(triangle, (k + 1) % 3);
+                        if (!HasEdge(b, a)) {
+                            openOut[a]++;
+                            openIn[b]++;
+                        }
+                        if (!HasWeldedEdge(b, a)) {
+                            weldedOpen[m_Canonical[a]]++;
+                            weldedOpen[m_Canonical[b]]++;
+                        }
+                    }
+                }
+
+                m_Kinds.assign(vertexCount, VertexKind::Locked);
+                for (uint32_t i = 0; i < (uint32_t)vertexCount; i++) {
+                    if (m_Canonical[i] != i)
+                        continue;
+
+                    uint32_t wedges = 0;
+                    uint32_t wedge = i;
+                    do {
+                        wedges++;
+                        wedge = m_NextWedge[wedge];
+                    } while (wedge != i);
+
+                    VertexKind kind = VertexKind::Locked;
+                    if (wedges == 1) {
+                        // Single-wedge vertices with open edges that weld shut are seam ends
+                        if (weldedOpen[i] == 0 && openOut[i] == 0 && openIn[i] == 0)
+                            kind = VertexKind::Manifold;
+                        else if (weldedOpen[i] == 2 && openOut[i] == 1 && openIn[i] == 1)
+                            kind = VertexKind::Border;
+                    } else if (wedges == 2 && weldedOpen[i] == 0) {
+                        uint32_t other = m_NextWedge[i];
+                        if (openOut[i] == 1 && openIn[i] == 1 && openOut[other] == 1 && openIn[other] == 1)
+                            kind = VertexKind::Seam;
+                    }
+
+                    wedge = i;
+                    do {
+                        m_Kinds[wedge] = kind;
+                        wedge = m_NextWedge[wedge];
+                    } while (wedge != i);
+                }
+            }
+
+            void BuildQuadrics() {
+                m_Quadrics.assign(m_Positions.size(), Quadric());
+
+                for (uint32_t triangle = 0; triangle < (uint32_t)(m_Indices.size() / 3); triangle++) {
+                    const glm::vec3& p0 = m_Positions[Corner(triangle, 0)];
+                    const glm::vec3& p1 = m_Positions[Corner(triangle, 1)];
+                    const glm::vec3& p2 = m_Positions[Corner(triangle, 2)];
+                    glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+                    float length = glm::length(normal);
+                    if (length <= 0.0f)
+                        continue;
+                    normal = normal / length;
+
+                    // Area weighted, so large faces dominate their corners
+                    float area = length * 0.5f;
+                    float d = -glm::dot(normal, p0);
+                    for (uint32_t k = 0; k < 3; k++)
+                        m_Quadrics[m_Canonical[Corner(triangle, k)]].AddPlane(normal.x, normal.y, normal.z, d, area);
+
+                    // Planes through open edges, perpendicular to the face, keep borders and seams in place
+                    for (uint32_t k = 0; k < 3; k++) {
+                        uint32_t a = Corner(triangle, k), b = Corner(triangle, (k + 1) % 3);
+                        if (HasEdge(b, a))
+                            continue;
+
+                        glm::vec3 edge = m_Positions[b] - m_Positions[a];
+                        float edgeLength = glm::length(edge);
+                        if (edgeLength <= 0.0f)
+                            continue;
+                        glm::vec3 plane = glm::normalize(glm::cross(edge, normal));
+                        float weight = edgeLength * edgeLength * (HasWeldedEdge(b, a) ? SeamWeight : BorderWeight);
+                        float planeD = -glm::dot(plane, m_Positions[a]);
+                        m_Quadrics[m_Canonical[a]].AddPlane(plane.x, plane.y, plane.z, planeD, weight);
+                        m_Quadrics[m_Canonical[b]].AddPlane(plane.x, plane.y, plane.z, planeD, weight);
+                    }
+                }
+            }
+
+            // Unpaired directed edges in attribute space: borders and both sides of every seam
+            void FindOpenEdges() {
+                m_OpenNext.assign(m_Positions.size(), InvalidIndex);
+                m_OpenPrev.assign(m_Positions.size(), InvalidIndex);
+
+                for (uint32_t triangle = 0; triangle < (uint32_t)(m_Indices.size() / 3); triangle++) {
+                    for (uint32_t k = 0; k < 3; k++) {
+                        uint32_t a = Corner(triangle, k), b = Corner(triangle, (k + 1) % 3);
+                        if (HasEdge(b, a))
+                            continue;
+                        m_OpenNext[a] = m_OpenNext[a] == InvalidIndex ? b : MultipleEdges;
+                        m_OpenPrev[b] = m_OpenPrev[b] == InvalidIndex ? a : MultipleEdges;
+                    }
+                }
+            }
+
+            static bool IsVertex(uint32_t index) { return index != InvalidIndex && index != MultipleEdges; }
+
+            bool IsOpenNeighbour(uint32_t vertex, uint32_t neighbour) const {
+                return m_OpenNext[vertex] == neighbour || m_OpenPrev[vertex] == neighbour;
+            }
+
+            bool MakeCollapse(uint32_t source, uint32_t target, Collapse& collapse) const {
+                if (m_Canonical[source] == m_Canonical[target])
+                    return false;
+
+                collapse = Collapse();
+                collapse.Source = source;
+                collapse.Target = target;
+
+                switch (m_Kinds[source]) {
+                    case VertexKind::Manifold:
+                        break;
+                    case VertexKind::Border:
+                        if (!IsOpenNeighbour(source, target))
+                            return false;
+                        break;
+                    case VertexKind::Seam: {
+                        if (!IsOpenNeighbour(source, target))
+                            return false;
+                        // The other side must slide to the matching wedge of the same neighbour
+                        uint32_t sibling = m_NextWedge[source];
+                        uint32_t candidates[2] = { m_OpenNext[sibling], m_OpenPrev[sibling] };
+                        for (uint32_t candidate : candidates) {
+                            if (IsVertex(candidate) && m_Canonical[candidate] == m_Canonical[target]) {
+                                collapse.SiblingSource = sibling;
+                                collapse.SiblingTarget = candidate;
+                            }
+                        }
+                        if (collapse.SiblingSource == InvalidIndex)
+                            return false;
+                        break;
+                    }
+                    default:
+                        return false;
+                }
+
+                Quadric quadric = m_Quadrics[m_Canonical[source]];
+                quadric.Add(m_Quadrics[m_Canonical[target]]);
+                collapse.Error = quadric.Error(m_Positions[target]);
+                return true;
+            }
+
+            void GatherCollapses(std::vector<Collapse>& candidates) const {
+                candidates.clear();
+                for (uint32_t triangle = 0; triangle < (uint32_t)(m_Indices.size() / 3); triangle++) {
+                    for (uint32_t k = 0; k < 3; k++) {
+                        uint32_t a = Corner(triangle, k), b = Corner(triangle, (k + 1) % 3);
+                        Collapse collapse;
+                        if (MakeCollapse(a, b, collapse))
+                            candidates.push_back(collapse);
+                        if (MakeCollapse(b, a, collapse))
+                            candidates.push_back(collapse);
+                    }
+                }
+            }
+
+            void GatherRing(uint32_t vertex, std::vector<uint32_t>& ring) const {
+                uint32_t wedge = vertex;
+                do {
+                    for (uint32_t i = m_Adjacency.Offsets[wedge]; i < m_Adjacency.Offsets[wedge + 1]; i++) {
+                        uint32_t triangle = m_Adjacency.Triangles[i];
+                        for (uint32_t k = 0; k < 3; k++) {
+                            uint32_t other = m_Canonical[Corner(triangle, k)];
+                            if (other != m_Canonical[vertex])
+                                ring.push_back(other);
+                        }
+                    }
+                    wedge = m_NextWedge[wedge];
+                } while (wedge != vertex);
+
+                std::sort(ring.begin(), ring.end());
+                ring.erase(std::unique(ring.begin(), ring.end()), ring.end());
+            }
+
+            // Checks the fan of one moving wedge; counts triangles that collapse away
+            bool CheckFan(uint32_t source, uint32_t target, uint32_t& removed) const {
+                const uint32_t targetCanonical = m_Canonical[target];
+                const glm::vec3& moved = m_Positions[target];
+
+                for (uint32_t i = m_Adjacency.Offsets[source]; i < m_Adjacency.Offsets[source + 1]; i++) {
+                    uint32_t triangle = m_Adjacency.Triangles[i];
+                    uint32_t corners[3] = { Corner(triangle, 0), Corner(triangle, 1), Corner(triangle, 2) };
+
+                    bool sharesTarget = false;
+                    for (uint32_t corner : corners) {
+                        if (m_Canonical[corner] != targetCanonical)
+                            continue;
+                        // Another attribute set of the target would end up on this face
+                        if (corner != target)
+                            return false;
+                        sharesTarget = true;
+                    }
+                    if (sharesTarget) {
+                        removed++;
+                        continue;
+                    }
+
+                    glm::vec3 before[3], after[3];
+                    for (uint32_t k = 0; k < 3; k++) {
+                        before[k] = m_Positions[corners[k]];
+                        after[k] = corners[k] == source ? moved : before[k];
+                    }
+                    glm::vec3 normalBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+                    glm::vec3 normalAfter = glm::cross(after[1] - after[0], after[2] - after[0]);
+                    // Flipped or nearly folded over
+                    if (glm::dot(normalBefore, normalAfter) < 0.25f * glm::length(normalBefore) * glm::length(normalAfter))
+                        return false;
+                }
+                return true;
+            }
+
+            bool CanCollapse(const Collapse& collapse, uint32_t& removed) const {
+                removed = 0;
+                if (!CheckFan(collapse.Source, collapse.Target, removed))
+                    return false;
+                if (collapse.SiblingSource != InvalidIndex && !CheckFan(collapse.SiblingSource, collapse.SiblingTarget, removed))
+                    return false;
+
+                // Link condition: the two rings may only meet at the faces being removed,
+                // otherwise the collapse pinches the surface
+                m_SourceRing.clear();
+                m_TargetRing.clear();
+                GatherRing(collapse.Source, m_SourceRing);
+                GatherRing(collapse.Target, m_TargetRing);
+                uint32_t shared = 0;
+                for (uint32_t vertex : m_SourceRing)
+                    if (vertex != m_Canonical[collapse.Target] && std::binary_search(m_TargetRing.begin(), m_TargetRing.end(), vertex))
+                        shared++;
+                return shared <= removed;
+            }
+
+            void LockRing(uint32_t vertex) {
+                m_Locked[m_Canonical[vertex]] = 1;
+                for (uint32_t i = m_Adjacency.Offsets[vertex]; i < m_Adjacency.Offsets[vertex + 1]; i++) {
+                    uint32_t triangle = m_Adjacency.Triangles[i];
+                    for (uint32_t k = 0; k < 3; k++)
+                        m_Locked[m_Canonical[Corner(triangle, k)]] = 1;
+                }
+            }
+
+            void ApplyRemap() {
+                size_t write = 0;
+                for (size_t i = 0; i < m_Indices.size(); i += 3) {
+                    uint32_t a = m_Remap[m_Indices[i]], b = m_Remap[m_Indices[i + 1]], c = m_Remap[m_Indices[i + 2]];
+                    if (a == b || b == c || a == c)
+                        continue;
+                    m_Indices[write++] = a;
+                    m_Indices[write++] = b;
+                    m_Indices[write++] = c;
+                }
+                m_Indices.resize(write);
+            }
+
+        private:
+            // Relative to face area; borders matter more than seams since gaps show
+            static constexpr float BorderWeight = 10.0f;
+            static constexpr float SeamWeight = 1.0f;
+
+            std::vector<uint32_t> m_Indices;
+            std::vector<glm::vec3> m_Positions;
+            std::vector<uint32_t> m_Canonical;
+            std::vector<uint32_t> m_NextWedge;
+            std::vector<VertexKind> m_Kinds;
+            std::vector<Quadric> m_Quadrics; // Indexed by canonical vertex
+            VertexTriangles m_Adjacency;
+
+            std::vector<uint32_t> m_OpenNext;
+            std::vector<uint32_t> m_OpenPrev;
+            std::vector<uint32_t> m_Remap;
+            std::vector<uint8_t> m_Locked;
+
+            mutable std::vector<uint32_t> m_SourceRing;
+            mutable std::vector<uint32_t> m_TargetRing;
+        };
+
+    }
+
+    std::vector<uint32_t> MeshSimplifier::Simplify(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                                                   size_t targetIndexCount, float targetError, float* resultError) {
+        if (resultError)
+            *resultError = 0.0f;
+        if (indices.size() < 3 || indices.size() % 3 != 0 || targetIndexCount >= indices.size())
+            return indices;
+
+        Simplifier simplifier(vertices, indices);
+        return simplifier.Run(targetIndexCount, targetError, resultError);
+    }
+
+    std::vector<std::vector<uint32_t>> MeshSimplifier::GenerateLODs(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                                                                    uint32_t maxLevels) {
+        // Error budget per level as a fraction of the mesh extent; coarse levels are only seen small
+        static const float LevelErrors[] = { 0.01f, 0.025f, 0.05f, 0.1f };
+        // Below this a mesh is cheap enough that switching LODs costs more than it saves
+        constexpr size_t MinTriangles = 128;
+
+        std::vector<std::vector<uint32_t>> lods;
+        if (indices.size() < MinTriangles * 3)
+            return lods;
+
+        const uint32_t levelCount = std::min<uint32_t>(maxLevels, (uint32_t)(sizeof(LevelErrors) / sizeof(LevelErrors[0])));
+        size_t previousCount = indices.size();
+        for (uint32_t level = 1; level <= levelCount; level++) {
+            // Always start from the full mesh so errors do not compound across levels
+            size_t target = (indices.size() >> level) / 3 * 3;
+            std::vector<uint32_t> lod = Simplify(vertices, indices, target, LevelErrors[level - 1]);
+
+            // A level that saves less than a tenth of the previous one is not worth switching to
+            if (lod.empty() || lod.size() * 10 > previousCount * 9)
+                break;
+
+            previousCount = lod.size();
+            lods.push_back(std::move(lod));
+        }
+        return lods;
+    }
+
+}
@@ -0,0 +1,239 @@
+#include "ClaudeEngine/Renderer/MeshletBuilder.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ClaudeEngine {
+
+    namespace {
+
+        constexpr uint32_t InvalidIndex = ~0u;
+
+        // Cones wider than this (dot of the axis with the widest normal) would almost never cull
+        constexpr float MinConeSpread = 0.1f;
+
+        // Vertex ids after merging vertices at the same position, so UV seams do not open the mesh
+        std::vector<uint32_t> WeldPositions(const std::vector<Vertex>& vertices) {
+            std::vector<uint32_t> order(vertices.size());
+            for (uint32_t i = 0; i < (uint32_t)order.size(); i++)
+                order[i] = i;
+
+            auto less = [&](uint32_t a, uint32_t b) {
+                const glm::vec3& pa = vertices[a].Position;
+                const glm::vec3& pb = vertices[b].Position;
+                if (pa.x != pb.x) return pa.x < pb.x;
+                if (pa.y != pb.y) return pa.y < pb.y;
+                return pa.z < pb.z;
+            };
+            std::sort(order.begin(), order.end(), less);
+
+            std::vector<uint32_t> welded(vertices.size());
+            for (size_t i = 0; i < order.size(); i++)
+                welded[order[i]] = (i > 0 && !less(order[i - 1], order[i])) ? welded[order[i - 1]] : order[i];
+            return welded;
+        }
+
+        glm::vec3 TriangleNormal(const std::vector<Vertex>& vertices, const uint32_t* corners) {
+            const glm::vec3& p0 = vertices[corners[0]].Position;
+            glm::vec3 normal = glm::cross(vertices[corners[1]].Position - p0, vertices[corners[2]].Position - p0);
+            float length = glm::length(normal);
+            return length > 0.0f ? normal / length : glm::vec3(0.0f);
+        }
+
+        void ComputeBounds(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& meshletVertices,
+                           const std::vector<uint32_t>& indices, const std::vector<glm::vec3>& normals, Meshlet& meshlet, bool coneCulling) {
+            AABB box;
+            for (uint32_t vertex : meshletVertices)
+                box.Expand(vertices[vertex].Position);
+            meshlet.Center = box.GetCenter();
+            meshlet.Radius = 0.0f;
+            for (uint32_t vertex : meshletVertices)
+                meshlet.Radius = std::max(meshlet.Radius, glm::length(vertices[vertex].Position - meshlet.Center));
+
+            if (!coneCulling)
+                return;
+
+            const uint32_t firstTriangle = meshlet.FirstIndex / 3;
+            const uint32_t lastTriangle = firstTriangle + meshlet.IndexCount / 3;
+            glm::vec3 axis(0.0f);
+            for (uint32_t t = firstTriangle; t < lastTriangle; t++)
+                axis += normals[t];
+            float axisLength = glm::length(axis);
+            if (axisLength == 0.0f)
+                return;
+            axis = axis / axisLength;
+
+            float minDot = 1.0f;
+            for (uint32_t t = firstTriangle; t < lastTriangle; t++) {
+                if (normals[t] != glm::vec3(0.0f))
+                    minDot = std::min(minDot, glm::dot(axis, normals[t]));
+            }
+            if (minDot <= MinConeSpread)
+                return;
+
+            // Move the apex back along the axis until it lies behind every triangle's plane, so
+            // views inside the cone see all of them from behind
+            float maxT = 0.0f;
+            for (uint32_t t = firstTriangle; t < lastTriangle; t++) {
+                if (normals[t] == glm::vec3(0.0f))
+                    continue;
+                const glm::vec3& p0 = vertices[indices[t * 3]].Position;
+                float distance = glm::dot(meshlet.Center - p0, normals[t]);
+                maxT = std::max(maxT, distance / glm::dot(axis, normals[t]));
+            }
+
+            meshlet.ConeAxis = axis;
+            meshlet.ConeApex = meshlet.Center - axis * maxT;
+            meshlet.ConeCutoff = std::sqrt(1.0f - minDot * minDot);
+        }
+
+    }
+
+    std::vector<Meshlet> MeshletBuilder::Build(const std::vector<Vertex>& vertices, std::vector<uint32_t>& indices, bool coneCulling) {
+        std::vector<Meshlet> meshlets;
+        const uint32_t vertexCount = (uint32_t)vertices.size();
+        const uint32_t triangleCount = (uint32_t)(indices.size() / 3);
+        if (triangleCount == 0)
+            return meshlets;
+
+        // Triangles around each vertex
+        std::vector<uint32_t> offsets(vertexCount + 1, 0);
+        for (uint32_t index : indices)
+            offsets[index + 1]++;
+        for (uint32_t i = 0; i < vertexCount; i++)
+            offsets[i + 1] += offsets[i];
+        std::vector<uint32_t> adjacency(indices.size());
+        {
+            std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+            for (uint32_t i = 0; i < (uint32_t)indices.size(); i++)
+                adjacency[cursor[indices[i]]++] = i / 3;
+        }
+
+        std::vector<glm::vec3> normals(triangleCount);
+        for (uint32_t t = 0; t < triangleCount; t++)
+            normals[t] = TriangleNormal(vertices, &indices[t * 3]);
+
+        // Stamps tell whether a vertex or candidate already belongs to the meshlet being built
+        std::vector<uint32_t> vertexStamp(vertexCount, InvalidIndex);
+        std::vector<uint32_t> candidateStamp(triangleCount, InvalidIndex);
+        std::vector<uint8_t> emitted(triangleCount, 0);
+
+        std::vector<uint32_t> output;
+        output.reserve(indices.size());
+        std::vector<glm::vec3> outputNormals;
+        outputNormals.reserve(triangleCount);
+        std::vector<uint32_t> candidates;
+        std::vector<uint32_t> meshletVertices;
+        uint32_t scanCursor = 0;
+
+        while (output.size() < indices.size()) {
+            const uint32_t stamp = (uint32_t)meshlets.size();
+            Meshlet meshlet;
+            meshlet.FirstIndex = (uint32_t)output.size();
+            meshletVertices.clear();
+            candidates.clear();
+            glm::vec3 normalSum(0.0f);
+
+            auto addTriangle = [&](uint32_t triangle) {
+                emitted[triangle] = 1;
+                normalSum += normals[triangle];
+                outputNormals.push_back(normals[triangle]);
+                for (uint32_t c = 0; c < 3; c++) {
+                    uint32_t vertex = indices[triangle * 3 + c];
+                    output.push_back(vertex);
+                    if (vertexStamp[vertex] == stamp)
+                        continue;
+                    vertexStamp[vertex] = stamp;
+                    meshletVertices.push_back(vertex);
+                    for (uint32_t j = offsets[vertex]; j < offsets[vertex + 1]; j++) {
+                        uint32_t neighbour = adjacency[j];
+                        if (!emitted[neighbour] && candidateStamp[neighbour] != stamp) {
+                            candidateStamp[neighbour] = stamp;
+                            candidates.push_back(neighbour);
+                        }
+                    }
+                }
+            };
+
+            // Seeds follow the input order, which is already cache-optimized
+            while (emitted[scanCursor])
+                scanCursor++;
+            addTriangle(scanCursor);
+
+            for (uint32_t triangles = 1; triangles < MaxTriangles; triangles++) {
+                float axisLength = glm::length(normalSum);
+                glm::vec3 axis = axisLength > 0.0f ? normalSum / axisLength : glm::vec3(0.0f);
+
+                uint32_t best = InvalidIndex;
+                uint32_t bestNewVertices = 4;
+                float bestSpread = 0.0f;
+                size_t live = 0;
+                for (size_t i = 0; i < candidates.size(); i++) {
+                    uint32_t triangle = candidates[i];
+                    if (emitted[triangle])
+                        continue;
+                    candidates[live++] = triangle;
+
+                    uint32_t newVertices = 0;
+                    for (uint32_t c = 0; c < 3; c++)
+                        newVertices += vertexStamp[indices[triangle * 3 + c]] == stamp ? 0 : 1;
+                    if (meshletVertices.size() + newVertices > MaxVertices)
+                        continue;
+
+                    float spread = 1.0f - glm::dot(normals[triangle], axis);
+                    if (newVertices < bestNewVertices || (newVertices == bestNewVertices && spread < bestSpread)) {
+                        best = triangle;
+                        bestNewVertices = newVertices;
+                        bestSpread = spread;
+                    }
+                }
+                candidates.resize(live);
+
+                // Disconnected pieces start a new meshlet rather than inflate this one's bounds
+                if (best == InvalidIndex)
+                    break;
+                addTriangle(best);
+            }
+
+            meshlet.IndexCount = (uint32_t)output.size() - meshlet.FirstIndex;
+            ComputeBounds(vertices, meshletVertices, output, outputNormals, meshlet, coneCulling);
+            meshlets.push_back(meshlet);
+        }
+
+        indices.swap(output);
+        return meshlets;
+    }
+
+    bool MeshletBuilder::CanConeCull(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices) {
+        const std::vector<uint32_t> welded = WeldPositions(vertices);
+
+        // Closed and consistently wound: every directed edge is used once and its reverse once
+        std::vector<uint64_t> edges;
+        edges.reserve(indices.size());
+        float volume = 0.0f;
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            uint32_t corners[3] = { welded[indices[i]], welded[indices[i + 1]], welded[indices[i + 2]] };
+            if (corners[0] == corners[1] || corners[1] == corners[2] || corners[2] == corners[0])
+                continue;
+            for (uint32_t c = 0; c < 3; c++)
+                edges.push_back(((uint64_t)corners[c] << 32) | corners[(c + 1) % 3]);
+
+            const glm::vec3& p0 = vertices[indices[i]].Position;
+            volume += glm::dot(p0, glm::cross(vertices[indices[i + 1]].Position, vertices[indices[i + 2]].Position));
+        }
+        if (edges.empty())
+            return false;
+
+        std::sort(edges.begin(), edges.end());
+        for (size_t i = 0; i < edges.size(); i++) {
+            if (i > 0 && edges[i] == edges[i - 1])
+                return false;
+            uint64_t reverse = (edges[i] << 32) | (edges[i] >> 32);
+            if (!std::binary_search(edges.begin(), edges.end(), reverse))
+                return false;
+        }
+
+        // Positive signed volume means the faces point outward
+        return volume > 0.0f;
+    }
+
+}
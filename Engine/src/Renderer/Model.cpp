@@ -1,4 +1,8 @@
 #include "ClaudeEngine/Renderer/Model.h"
+#include "ClaudeEngine/Renderer/MeshSimplifier.h"
+#include "ClaudeEngine/Renderer/MeshOptimizer.h"
+#include "ClaudeEngine/Renderer/MeshletBuilder.h"
+#include "ClaudeEngine/Renderer/TriangleBVH.h"
 #include "ClaudeEngine/Core/Log.h"
 
 #include <assimp/Importer.hpp>
@@ -7,6 +11,25 @@
 
 namespace ClaudeEngine {
 
+    static VertexFormat s_ImportVertexFormat = VertexFormat::Standard;
+    static bool s_ImportMeshlets = true;
+
+    void Model::SetImportVertexFormat(VertexFormat format) {
+        s_ImportVertexFormat = format;
+    }
+
+    VertexFormat Model::GetImportVertexFormat() {
+        return s_ImportVertexFormat;
+    }
+
+    void Model::SetImportMeshlets(bool enabled) {
+        s_ImportMeshlets = enabled;
+    }
+
+    bool Model::GetImportMeshlets() {
+        return s_ImportMeshlets;
+    }
+
     Model::Model(const std::string& path) {
         LoadModel(path);
     }
@@ -17,6 +40,24 @@ namespace ClaudeEngine {
         }
     }
 
+    bool Model::Raycast(const Ray& ray, float maxDistance, float& distance) const {
+        bool found = false;
+        for (const auto& mesh : m_Meshes) {
+            float entry;
+            if (!mesh->GetBoundingBox().Intersects(ray, maxDistance, entry))
+                continue;
+
+            RayHit hit;
+            if (mesh->GetTriangleBVH().Intersect(ray, maxDistance, hit)) {
+                maxDistance = hit.Distance;
+                found = true;
+            }
+        }
+        if (found)
+            distance = maxDistance;
+        return found;
+    }
+
     void Model::LoadModel(const std::string& path) {
         CE_CORE_INFO("Loading model: ", path);
 
@@ -34,6 +75,9 @@ namespace ClaudeEngine {
 
         m_Directory = path.substr(0, path.find_last_of('/'));
 
+        // Post-transform cache misses over every mesh, before and after optimization
+        uint32_t triangles = 0, missesBefore = 0, missesAfter = 0;
+
         // Process nodes recursively
         std::function<void(aiNode*, const aiScene*)> processNode = [&](aiNode* node, const aiScene* scene) {
             // Process all meshes
@@ -78,7 +122,22 @@ namespace ClaudeEngine {
                     // Load textures here if needed
                 }
 
-                m_Meshes.push_back(CreateRef<Mesh>(vertices, indices, textures));
+                triangles += (uint32_t)(indices.size() / 3);
+                missesBefore += MeshOptimizer::AnalyzeVertexCache(indices, (uint32_t)vertices.size()).Misses;
+                MeshOptimizer::OptimizeVertexCache(indices, (uint32_t)vertices.size());
+                MeshOptimizer::OptimizeOverdraw(indices, vertices);
+                // Meshlets regroup LOD 0 triangles, seeding clusters in the optimized order
+                std::vector<Meshlet> meshlets;
+                if (s_ImportMeshlets && indices.size() / 3 >= MeshletBuilder::MinTriangles)
+                    meshlets = MeshletBuilder::Build(vertices, indices, MeshletBuilder::CanConeCull(vertices, indices));
+                MeshOptimizer::OptimizeVertexFetch(vertices, indices);
+                missesAfter += MeshOptimizer::AnalyzeVertexCache(indices, (uint32_t)vertices.size()).Misses;
+
+                // Simplification reshuffles triangles, so each level gets its own cache pass
+                auto lods = MeshSimplifier::GenerateLODs(vertices, indices);
+                for (auto& lod : lods)
+                    MeshOptimizer::OptimizeVertexCache(lod, (uint32_t)vertices.size());
+                AddMesh(CreateRef<Mesh>(vertices, indices, textures, lods, s_ImportVertexFormat, meshlets));
             }
 
             // Process children
@@ -88,7 +147,11 @@ namespace ClaudeEngine {
         };
 
         processNode(scene->mRootNode, scene);
-        CE_CORE_INFO("Model loaded successfully: ", m_Meshes.size(), " meshes");
+        CE_CORE_INFO("Model loaded successfully: ", m_Meshes.size(), " meshes, ", m_LODCount, " LODs");
+        if (triangles > 0) {
+            CE_CORE_INFO("Vertex cache ACMR: ", (float)missesBefore / triangles, " -> ", (float)missesAfter / triangles,
+                         " over ", triangles, " triangles");
+        }
     }
 
 }
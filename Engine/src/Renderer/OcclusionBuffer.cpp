@@ -0,0 +1,91 @@
+#include "ClaudeEngine/Renderer/OcclusionBuffer.h"
+#include <algorithm>
+
+namespace ClaudeEngine {
+
+    void OcclusionBuffer::Update(const DepthPyramid::Readback& readback) {
+        if (readback.Width == 0 || readback.Height == 0) {
+            Clear();
+            return;
+        }
+
+        uint32_t levelCount = 1;
+        while ((std::max(readback.Width, readback.Height) >> levelCount) > 0)
+            levelCount++;
+        m_Levels.resize(levelCount);
+
+        m_Levels[0].Width = readback.Width;
+        m_Levels[0].Height = readback.Height;
+        m_Levels[0].Depth.assign(readback.Depth.begin(), readback.Depth.end());
+
+        // Same max reduction as HiZBuild.glsl, continued below the copied level
+        for (uint32_t i = 1; i < levelCount; i++) {
+            const Level& source = m_Levels[i - 1];
+            Level& level = m_Levels[i];
+            level.Width = std::max(source.Width / 2, 1u);
+            level.Height = std::max(source.Height / 2, 1u);
+            level.Depth.resize((size_t)level.Width * level.Height);
+
+            for (uint32_t y = 0; y < level.Height; y++) {
+                uint32_t y0 = std::min(y * 2, source.Height - 1);
+                uint32_t y1 = std::min(y * 2 + 1, source.Height - 1);
+                for (uint32_t x = 0; x < level.Width; x++) {
+                    uint32_t x0 = std::min(x * 2, source.Width - 1);
+                    uint32_t x1 = std::min(x * 2 + 1, source.Width - 1);
+                    level.Depth[(size_t)y * level.Width + x] = std::max(
+                        std::max(source.Fetch(x0, y0), source.Fetch(x1, y0)),
+                        std::max(source.Fetch(x0, y1), source.Fetch(x1, y1)));
+                }
+            }
+        }
+
+        m_ViewProjection = readback.ViewProjection;
+    }
+
+    bool OcclusionBuffer::IsOccluded(const AABB& worldBounds) const {
+        if (m_Levels.empty() || !worldBounds.IsValid())
+            return false;
+
+        glm::vec2 uvMin(1.0f), uvMax(0.0f);
+        float nearest = 1.0f;
+        for (int i = 0; i < 8; i++) {
+            glm::vec3 corner((i & 1) ? worldBounds.Max.x : worldBounds.Min.x,
+                             (i & 2) ? worldBounds.Max.y : worldBounds.Min.y,
+                             (i & 4) ? worldBounds.Max.z : worldBounds.Min.z);
+            glm::vec4 clip = m_ViewProjection * glm::vec4(corner, 1.0f);
+            // Boxes crossing the near plane have no finite screen rect
+            if (clip.w <= 0.0f)
+                return false;
+
+            glm::vec3 ndc = glm::vec3(clip) / clip.w;
+            glm::vec2 uv = glm::vec2(ndc.x, ndc.y) * 0.5f + 0.5f;
+            uvMin = glm::min(uvMin, uv);
+            uvMax = glm::max(uvMax, uv);
+            nearest = std::min(nearest, ndc.z * 0.5f + 0.5f);
+        }
+
+        // Outside the captured view there is no depth to compare against
+        if (uvMax.x < 0.0f || uvMax.y < 0.0f || uvMin.x > 1.0f || uvMin.y > 1.0f)
+            return false;
+        uvMin = glm::vec2(std::max(uvMin.x, 0.0f), std::max(uvMin.y, 0.0f));
+        uvMax = glm::vec2(std::min(uvMax.x, 1.0f), std::min(uvMax.y, 1.0f));
+
+        // First level where the rect spans at most two texels per axis, so four fetches cover it
+        const Level& base = m_Levels[0];
+        float extent = std::max((uvMax.x - uvMin.x) * base.Width, (uvMax.y - uvMin.y) * base.Height);
+        uint32_t levelIndex = 0;
+        while (levelIndex + 1 < m_Levels.size() && (float)(1u << levelIndex) < extent)
+            levelIndex++;
+
+        const Level& level = m_Levels[levelIndex];
+        uint32_t x0 = std::min((uint32_t)(uvMin.x * level.Width), level.Width - 1);
+        uint32_t y0 = std::min((uint32_t)(uvMin.y * level.Height), level.Height - 1);
+        uint32_t x1 = std::min((uint32_t)(uvMax.x * level.Width), level.Width - 1);
+        uint32_t y1 = std::min((uint32_t)(uvMax.y * level.Height), level.Height - 1);
+
+        float farthest = std::max(std::max(level.Fetch(x0, y0), level.Fetch(x1, y0)),
+                                  std::max(level.Fetch(x0, y1), level.Fetch(x1, y1)));
+        return nearest > farthest;
+    }
+
+}
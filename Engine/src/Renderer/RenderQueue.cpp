@@ -0,0 +1,88 @@
+#include "ClaudeEngine/Renderer/RenderQueue.h"
+#include <algorithm>
+
+namespace ClaudeEngine {
+
+    static uint64_t QuantizeDepth(float depth) {
+        const uint64_t maxDepth = (1ull << RenderSortKey::DepthBits) - 1;
+        float clamped = std::min(std::max(depth, 0.0f), 1.0f);
+        return (uint64_t)(clamped * (float)maxDepth);
+    }
+
+    uint64_t RenderSortKey::Encode(RenderPass pass, uint32_t shaderID, uint32_t materialID, uint32_t meshID, float depth) {
+        uint64_t shader = shaderID & ((1u << ShaderBits) - 1);
+        uint64_t material = materialID & ((1u << MaterialBits) - 1);
+        uint64_t mesh = meshID & ((1u << MeshBits) - 1);
+        uint64_t depthBits = QuantizeDepth(depth);
+
+        uint64_t key = (uint64_t)pass << 62;
+        if (pass == RenderPass::Transparent) {
+            // Blending needs back-to-front order, so depth outranks state
+            uint64_t inverted = ((1ull << DepthBits) - 1) - depthBits;
+            key |= inverted << (MeshBits + MaterialBits + ShaderBits);
+            key |= shader << (MeshBits + MaterialBits);
+            key |= material << MeshBits;
+            key |= mesh;
+        } else {
+            key |= shader << (DepthBits + MeshBits + MaterialBits);
+            key |= material << (DepthBits + MeshBits);
+            key |= mesh << DepthBits;
+            key |= depthBits;
+        }
+        return key;
+    }
+
+    void RenderQueue::Clear() {
+        m_Packets.clear();
+        m_Entries.clear();
+        m_ShaderIDs.clear();
+        m_MaterialIDs.clear();
+        m_MeshIDs.clear();
+    }
+
+    void RenderQueue::Submit(DrawPacket&& packet) {
+        uint32_t shaderID = GetResourceID(m_ShaderIDs, packet.ShaderProgram.get());
+        uint32_t materialID = GetResourceID(m_MaterialIDs, packet.MaterialInstance.get());
+        uint32_t meshID = GetMeshID(packet);
+
+        uint64_t key = RenderSortKey::Encode(packet.Pass, shaderID, materialID, meshID, packet.Depth);
+        m_Entries.push_back({ key, (uint32_t)m_Packets.size() });
+        m_Packets.push_back(std::move(packet));
+    }
+
+    void RenderQueue::Sort() {
+        // Only the 16-byte entries move; packets stay where they were submitted
+        std::sort(m_Entries.begin(), m_Entries.end(), [](const Entry& a, const Entry& b) {
+            return a.Key < b.Key;
+        });
+    }
+
+    uint32_t RenderQueue::GetResourceID(std::unordered_map<const void*, uint32_t>& ids, const void* resource) {
+        if (!resource)
+            return 0;
+
+        auto it = ids.find(resource);
+        if (it != ids.end())
+            return it->second;
+
+        // 0 is reserved for "no resource"
+        uint32_t id = (uint32_t)ids.size() + 1;
+        ids.emplace(resource, id);
+        return id;
+    }
+
+    uint32_t RenderQueue::GetMeshID(const DrawPacket& packet) {
+        if (!packet.Geometry)
+            return 0;
+
+        auto key = std::make_pair((const void*)packet.Geometry.get(), packet.FirstIndex);
+        auto it = m_MeshIDs.find(key);
+        if (it != m_MeshIDs.end())
+            return it->second;
+
+        uint32_t id = (uint32_t)m_MeshIDs.size() + 1;
+        m_MeshIDs.emplace(key, id);
+        return id;
+    }
+
+}
@@ -1,6 +1,9 @@
 #include "ClaudeEngine/Renderer/Renderer.h"
+#include "ClaudeEngine/Renderer/StorageBuffer.h"
 #include "ClaudeEngine/Renderer/RenderCommand.h"
 #include "ClaudeEngine/Renderer/VertexArray.h"
+#include "ClaudeEngine/Renderer/GeometryPool.h"
+#include <cstring>
 
 namespace ClaudeEngine {
 
@@ -8,9 +11,13 @@ namespace ClaudeEngine {
 
     void Renderer::Init() {
         RenderCommand::Init();
+        GeometryPool::Init();
+        s_SceneData->FrameStream = StreamBuffer::Create(StreamBufferSize);
     }
 
     void Renderer::Shutdown() {
+        GeometryPool::Shutdown();
+        s_SceneData->FrameStream = nullptr;
     }
 
     void Renderer::OnWindowResize(uint32_t width, uint32_t height) {
@@ -19,14 +26,33 @@ namespace ClaudeEngine {
 
     void Renderer::BeginScene(Camera& camera) {
         s_SceneData->ViewProjectionMatrix = camera.GetProjection();
+
+        CameraData data = {};
+        data.ViewProjection = s_SceneData->ViewProjectionMatrix;
+        data.View = glm::mat4(1.0f);
+        data.Projection = camera.GetProjection();
+        data.Position = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        SetCameraData(data);
+    }
+
+    void Renderer::SetCameraData(const CameraData& data) {
+        // A fresh range per call, so scenes rendered earlier in the frame keep their own camera
+        StreamAllocation allocation = s_SceneData->FrameStream->Allocate(sizeof(CameraData), StreamBuffer::Usage::Uniform);
+        std::memcpy(allocation.Data, &data, sizeof(CameraData));
+        s_SceneData->FrameStream->Bind(StreamBuffer::Usage::Uniform, CameraBinding, allocation);
+    }
+
+    void Renderer::EndFrame() {
+        s_SceneData->FrameStream->EndFrame();
+        StorageBuffer::EndFrame();
     }
 
     void Renderer::EndScene() {
     }
 
     void Renderer::Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const glm::mat4& transform) {
+        // View-projection comes from the camera block uploaded in BeginScene
         shader->Bind();
-        shader->SetMat4("u_ViewProjection", s_SceneData->ViewProjectionMatrix);
         shader->SetMat4("u_Transform", transform);
 
         vertexArray->Bind();
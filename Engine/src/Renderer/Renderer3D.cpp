@@ -1,28 +1,141 @@
 #include "ClaudeEngine/Renderer/Renderer3D.h"
 #include "ClaudeEngine/Renderer/RenderCommand.h"
 #include "ClaudeEngine/Renderer/Buffer.h"
+#include "ClaudeEngine/Renderer/Renderer.h"
+#include "ClaudeEngine/Renderer/StorageBuffer.h"
 #include "ClaudeEngine/Renderer/Model.h"
+#include "ClaudeEngine/Renderer/Material.h"
+#include "ClaudeEngine/Renderer/RenderQueue.h"
+#include "ClaudeEngine/Renderer/RenderCommandList.h"
+#include "ClaudeEngine/Renderer/MeshPrimitives.h"
+#include "ClaudeEngine/Renderer/DepthPyramid.h"
+#include "ClaudeEngine/Renderer/OcclusionBuffer.h"
+#include "ClaudeEngine/Renderer/LODSelector.h"
+#include "ClaudeEngine/Renderer/Framebuffer.h"
 #include "ClaudeEngine/Core/Log.h"
 #include <glad/glad.h>
 #include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 
 namespace ClaudeEngine {
 
+    // std430 element of the Instances storage buffer, indexed by gl_BaseInstance + gl_InstanceID
+    struct InstanceData {
+        glm::mat4 Transform;
+        glm::vec4 Color;
+    };
+
+    struct InstanceBatch {
+        uint32_t FirstEntry;
+        uint32_t InstanceCount;
+        uint32_t BaseInstance;
+    };
+
+    // Consecutive batches submitted with one multi-draw call
+    struct DrawGroupRange {
+        uint32_t FirstBatch;
+        uint32_t LastBatch;
+        uint32_t InstanceCount;
+        bool GPUCulled;
+    };
+
+    // std430 elements of the GPU culling buffers, see FrustumCull.glsl
+    struct CullRecord {
+        glm::vec3 Center;
+        uint32_t Batch;
+        glm::vec3 Extents; // Negative: always visible
+        uint32_t Group;
+    };
+
+    struct DrawGroup {
+        uint32_t DrawCount;
+        uint32_t FirstCommand;
+    };
+
+    static_assert(sizeof(CullRecord) == 32, "CullRecord must match the std430 layout");
+    static_assert(sizeof(DrawIndexedIndirectCommand) == 20, "Indirect commands must be tightly packed");
+
+    static const uint32_t NoCullGroup = 0xFFFFFFFF;
+
     struct Renderer3DData {
+        static const uint32_t MaxInstances = 16384;
+
         // Grid
         Ref<Shader> GridShader;
         Ref<VertexArray> GridVAO;
 
         // Basic cube for primitives
         Ref<Shader> BasicShader;
+        Ref<Shader> EntityIDShader;
+        // Built synchronously from inline source; draws whatever uses a shader still compiling
+        Ref<Shader> FallbackShader;
+        // Names of shaders seen failing, which keep drawing with the fallback
+        std::vector<std::string> FailedShaders;
+        Ref<Mesh> CubeMesh;
         Ref<VertexArray> CubeVAO;
 
+        // Tells mesh shaders how to decode the bound page's attributes
+        UniformHandle VertexFormatHandle = 0;
+
         // Scene data
-        glm::mat4 ViewProjectionMatrix;
-        glm::mat4 ViewMatrix;
-        glm::mat4 ProjectionMatrix;
-        float NearClip = 0.1f;
-        float FarClip = 1000.0f;
+        RenderView View;
+
+        // Deferred draw submission
+        RenderQueue Queue;
+
+        // Instancing
+        static const uint32_t InstanceSegments = 3; // Frames the GPU may lag behind
+        // Instances a frame can draw before its storage segments run out and it has to wait
+        static const uint32_t FrameInstances = 4 * MaxInstances;
+        // Cull passes per frame, each taking one counter aligned to at most 256 bytes
+        static const uint32_t FrameCullPasses = 16;
+        StreamAllocation InstanceAllocation;    // Carved from the frame stream per chunk
+        InstanceData* InstanceMapped = nullptr; // Written in place
+        uint32_t InstanceCapacity = 0;
+        std::vector<InstanceBatch> Batches;
+        uint32_t InstanceCount = 0;
+
+        // One indirect command per batch; every batch holds at least one instance
+        Ref<StorageBuffer> CommandBuffer;
+        std::vector<DrawGroupRange> Groups;
+
+        // GPU culling
+        Ref<Shader> CullShader;
+        Ref<StorageBuffer> CullRecordBuffer;
+        Ref<StorageBuffer> DrawGroupBuffer;
+        Ref<StorageBuffer> VisibleCommandBuffer; // Written by the cull pass only
+        UniformHandle FrustumPlaneHandles[Frustum::Count];
+        UniformHandle RecordCountHandle = 0;
+        UniformHandle OcclusionCullingHandle = 0;
+        Ref<StorageBuffer> CullStatsBuffer; // One occluded counter per cull pass
+        // Counters of the passes that used each CullStatsBuffer segment, read when it is handed out again
+        std::vector<uint32_t*> OccludedCounters[InstanceSegments];
+        bool GPUCullingSupported = false;
+        bool GPUCullingEnabled = false;
+
+        // Occlusion culling
+        static const uint32_t MaxOccluders = 64;
+        static constexpr float OccluderMinScreenSize = 0.25f; // Bounding radius over distance
+        RenderQueue OccluderQueue;
+        uint32_t OccluderCount = 0;
+        Ref<DepthPyramid> Pyramid;
+        DepthPyramid::Readback PyramidReadback; // Reused between polls
+        OcclusionBuffer CPUOcclusion;
+        bool PyramidReady = false; // Built this frame, so the GPU cull pass may test against it
+        bool OcclusionSupported = false;
+        bool OcclusionEnabled = false;
+
+        // Meshlet culling
+        bool MeshletCullingEnabled = true;
+
+        // Flush state
+        bool PassApplied = false;
+        RenderPass CurrentPass = RenderPass::Opaque;
+        Shader* BoundShader = nullptr;
+        Material* BoundMaterial = nullptr;
+        VertexArray* BoundVertexArray = nullptr;
 
         // Stats
         Renderer3D::Statistics Stats;
@@ -35,8 +148,14 @@ namespace ClaudeEngine {
         s_Data = new Renderer3DData();
         CE_INFO("Renderer3D data allocated");
 
+        // File shaders compile in the background from here on; the fallback covers for them
         InitGrid();
         InitCube();
+        InitFallbackShader();
+        InitInstancing();
+        InitGPUCulling();
+        InitOcclusionCulling();
+        InitEntityIDs();
         
         CE_INFO("Renderer3D::Init() completed successfully");
     }
@@ -47,17 +166,52 @@ namespace ClaudeEngine {
     }
 
     void Renderer3D::BeginScene(const EditorCamera& camera) {
-        s_Data->ViewMatrix = camera.GetViewMatrix();
-        s_Data->ProjectionMatrix = camera.GetProjection();
-        s_Data->ViewProjectionMatrix = camera.GetViewProjection();
-        s_Data->NearClip = 0.1f; // Match camera settings
-        s_Data->FarClip = 1000.0f;
+        BeginScene(RenderView::FromCamera(camera));
+    }
+
+    void Renderer3D::BeginScene(const RenderView& view) {
+        s_Data->View = view;
+
+        // Bound once for the whole scene instead of per shader switch
+        CameraData cameraData = {};
+        cameraData.ViewProjection = view.ViewProjectionMatrix;
+        cameraData.View = view.ViewMatrix;
+        cameraData.Projection = view.ProjectionMatrix;
+        cameraData.Position = glm::vec4(view.CameraPosition, 1.0f);
+        cameraData.NearClip = view.NearClip;
+        cameraData.FarClip = view.FarClip;
+        Renderer::SetCameraData(cameraData);
 
+        s_Data->Queue.Clear();
+        s_Data->OccluderQueue.Clear();
+        s_Data->OccluderCount = 0;
+        s_Data->PyramidReady = false;
+
+        // ImGui renders between our frames with raw GL calls
+        RenderCommand::InvalidateStateCache();
         ResetStats();
     }
 
     void Renderer3D::EndScene() {
-        // Nothing to do yet
+        Flush();
+    }
+
+    // Not ready yet or failed; failures are remembered so the editor can show them
+    static bool IsShaderReady(Shader& shader) {
+        ShaderStatus status = shader.GetStatus();
+        if (status == ShaderStatus::Failed) {
+            auto& failed = s_Data->FailedShaders;
+            if (std::find(failed.begin(), failed.end(), shader.GetName()) == failed.end())
+                failed.push_back(shader.GetName());
+        }
+        return status == ShaderStatus::Ready;
+    }
+
+    static float ComputeViewDepth(const RenderView& view, const glm::mat4& transform) {
+        // Depth of the object's origin, normalized to [0, 1] over the clip range
+        glm::vec4 viewPos = view.ViewMatrix * transform[3];
+        float depth = (-viewPos.z - view.NearClip) / (view.FarClip - view.NearClip);
+        return glm::clamp(depth, 0.0f, 1.0f);
     }
 
     void Renderer3D::DrawGrid() {
@@ -65,71 +219,665 @@ namespace ClaudeEngine {
             CE_WARN("Renderer3D: Cannot draw grid - shader or VAO is null");
             return;
         }
+        // A flat fallback would cover the whole screen; the grid just appears once it is ready
+        if (!IsShaderReady(*s_Data->GridShader))
+            return;
+
+        DrawPacket packet;
+        packet.Pass = RenderPass::Transparent;
+        packet.ShaderProgram = s_Data->GridShader;
+        packet.Geometry = s_Data->GridVAO;
+        packet.IndexCount = s_Data->GridVAO->GetIndexBuffer()->GetCount();
+        packet.Depth = 1.0f; // Fullscreen plane, blend it before anything closer
+        s_Data->Queue.Submit(std::move(packet));
+    }
+
+    static DrawPacket MakeCubePacket(const RenderView& view, const glm::mat4& transform, const glm::vec4& color) {
+        DrawPacket packet;
+        packet.ShaderProgram = s_Data->BasicShader;
+        packet.Geometry = s_Data->CubeVAO;
+        packet.Transform = transform;
+        packet.Color = color;
+        packet.IndexCount = s_Data->CubeMesh->GetIndexCount();
+        packet.VertexCount = s_Data->CubeMesh->GetVertexCount();
+        packet.FirstIndex = s_Data->CubeMesh->GetFirstIndex();
+        packet.BaseVertex = s_Data->CubeMesh->GetBaseVertex();
+        packet.Depth = ComputeViewDepth(view, transform);
+        packet.Bounds = s_Data->CubeMesh->GetBoundingBox().Transform(transform);
+        packet.GPUCulled = Renderer3D::IsGPUCullingActive();
+        return packet;
+    }
 
-        glEnable(GL_DEPTH_TEST);
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    void Renderer3D::DrawCube(const glm::mat4& transform, const glm::vec4& color) {
+        s_Data->Queue.Submit(MakeCubePacket(s_Data->View, transform, color));
+    }
 
-        s_Data->GridShader->Bind();
-        s_Data->GridShader->SetMat4("u_ViewProjection", s_Data->ViewProjectionMatrix);
-        s_Data->GridShader->SetFloat("u_Near", s_Data->NearClip);
-        s_Data->GridShader->SetFloat("u_Far", s_Data->FarClip);
+    // Culls the mesh's meshlets and appends one index range per run of survivors. ranges holds
+    // {first, count} pairs relative to the mesh; bounds receives each range's world bounds.
+    static void CullMeshlets(const RenderView& view, const Mesh& mesh, const glm::mat4& transform,
+                             std::vector<std::pair<uint32_t, uint32_t>>& ranges, std::vector<AABB>& bounds, Renderer3D::Statistics& stats) {
+        const glm::vec3 localCamera = glm::vec3(glm::inverse(transform) * glm::vec4(view.CameraPosition, 1.0f));
+        // Spheres stay spheres under the largest axis scale
+        const float scale = std::max(glm::length(glm::vec3(transform[0])),
+                                     std::max(glm::length(glm::vec3(transform[1])), glm::length(glm::vec3(transform[2]))));
 
-        s_Data->GridVAO->Bind();
-        RenderCommand::DrawIndexed(s_Data->GridVAO);
+        bool extend = false;
+        for (const Meshlet& meshlet : mesh.GetMeshlets()) {
+            // The cone test is done in local space, so it holds for any affine transform
+            if (meshlet.IsBackFacing(localCamera)) {
+                stats.BackfaceCulledMeshlets++;
+                extend = false;
+                continue;
+            }
 
-        glDisable(GL_BLEND);
+            glm::vec3 center = glm::vec3(transform * glm::vec4(meshlet.Center, 1.0f));
+            float radius = meshlet.Radius * scale;
+            if (!view.ViewFrustum.Intersects(center, radius)) {
+                stats.FrustumCulledMeshlets++;
+                extend = false;
+                continue;
+            }
 
-        s_Data->Stats.DrawCalls++;
+            stats.VisibleMeshlets++;
+            AABB sphereBounds(center - glm::vec3(radius), center + glm::vec3(radius));
+            if (extend) {
+                ranges.back().second += meshlet.IndexCount;
+                bounds.back().Expand(sphereBounds);
+            } else {
+                ranges.push_back({ meshlet.FirstIndex, meshlet.IndexCount });
+                bounds.push_back(sphereBounds);
+            }
+            extend = true;
+        }
     }
 
-    void Renderer3D::DrawCube(const glm::mat4& transform, const glm::vec4& color) {
-        s_Data->BasicShader->Bind();
-        s_Data->BasicShader->SetMat4("u_ViewProjection", s_Data->ViewProjectionMatrix);
-        s_Data->BasicShader->SetMat4("u_Transform", transform);
-        s_Data->BasicShader->SetFloat4("u_Color", color);
+    // Reads nothing but view and renderer settings, so command lists may record through it from
+    // other threads. Queue is anything with Submit(DrawPacket&&); stats receives the meshlet counts.
+    template<typename Queue>
+    static void SubmitModel(Queue& queue, const RenderView& view, Renderer3D::Statistics& stats, bool allowMeshlets,
+                            const Ref<Model>& model, const glm::mat4& transform, const Ref<Material>& material,
+                            const AABB& worldBounds, uint32_t lod, bool cullOnGPU) {
+        // Materials without a shader fall back to the basic color shader
+        bool useMaterial = material && material->GetShader();
+        float depth = ComputeViewDepth(view, transform);
+        // Uncullable models (invalid bounds) and the occluder pre-pass always draw whole meshes
+        const bool meshletCulling = allowMeshlets && s_Data->MeshletCullingEnabled && lod == 0 && worldBounds.IsValid();
+        std::vector<std::pair<uint32_t, uint32_t>> ranges;
+        std::vector<AABB> rangeBounds;
+
+        for (auto& mesh : model->GetMeshes()) {
+            DrawPacket packet;
+            packet.ShaderProgram = useMaterial ? material->GetShader() : s_Data->BasicShader;
+            packet.MaterialInstance = useMaterial ? material : nullptr;
+            packet.Geometry = mesh->GetVertexArray();
+            packet.Format = mesh->GetVertexFormat();
+            // Folding dequantization into the instance transform keeps shaders format-agnostic for positions
+            packet.Transform = mesh->HasQuantizedPositions() ? transform * mesh->GetDequantizeTransform() : transform;
+            packet.Color = glm::vec4(0.8f, 0.8f, 0.8f, 1.0f);
+            packet.VertexCount = mesh->GetVertexCount();
+            packet.BaseVertex = mesh->GetBaseVertex();
+            packet.Depth = depth;
+            packet.GPUCulled = cullOnGPU && worldBounds.IsValid();
+
+            if (meshletCulling && mesh->HasMeshlets()) {
+                ranges.clear();
+                rangeBounds.clear();
+                CullMeshlets(view, *mesh, transform, ranges, rangeBounds, stats);
 
-        s_Data->CubeVAO->Bind();
-        RenderCommand::DrawIndexed(s_Data->CubeVAO);
+                // Tighter bounds let the GPU pass occlusion-cull each range on its own
+                for (size_t i = 0; i < ranges.size(); i++) {
+                    DrawPacket rangePacket = packet;
+                    rangePacket.FirstIndex = mesh->GetFirstIndex() + ranges[i].first;
+                    rangePacket.IndexCount = ranges[i].second;
+                    rangePacket.Bounds = rangeBounds[i];
+                    queue.Submit(std::move(rangePacket));
+                }
+                continue;
+            }
 
-        s_Data->Stats.DrawCalls++;
-        s_Data->Stats.Vertices += 24;
-        s_Data->Stats.Triangles += 12;
+            const MeshLOD& range = mesh->GetLOD(lod);
+            packet.IndexCount = range.IndexCount;
+            packet.FirstIndex = mesh->GetFirstIndex() + range.FirstIndex;
+            packet.Bounds = worldBounds;
+            queue.Submit(std::move(packet));
+        }
     }
 
-    void Renderer3D::DrawModel(const Ref<Model>& model, const glm::mat4& transform) {
+    void Renderer3D::DrawModel(const Ref<Model>& model, const glm::mat4& transform, const Ref<Material>& material,
+                               const AABB& worldBounds, uint32_t lod, bool cullOnGPU) {
         if (!model) return;
+        SubmitModel(s_Data->Queue, s_Data->View, s_Data->Stats, true, model, transform, material, worldBounds, lod, cullOnGPU);
+    }
 
-        // Get meshes from model
-        auto& meshes = model->GetMeshes();
-        for (auto& mesh : meshes) {
-            // Use basic shader for now (TODO: integrate materials)
-            s_Data->BasicShader->Bind();
-            s_Data->BasicShader->SetMat4("u_ViewProjection", s_Data->ViewProjectionMatrix);
-            s_Data->BasicShader->SetMat4("u_Transform", transform);
-            s_Data->BasicShader->SetFloat4("u_Color", glm::vec4(0.8f, 0.8f, 0.8f, 1.0f));
+    void Renderer3D::DrawEntityID(const Ref<Model>& model, const glm::mat4& transform, int entityID) {
+        if (!model || !s_Data->EntityIDShader) return;
 
-            mesh->GetVertexArray()->Bind();
-            RenderCommand::DrawIndexed(mesh->GetVertexArray());
+        // The ID rides in the instance color's bits, so it batches and instances like any draw
+        float encodedID;
+        std::memcpy(&encodedID, &entityID, sizeof(float));
+        for (auto& mesh : model->GetMeshes()) {
+            DrawPacket packet;
+            packet.ShaderProgram = s_Data->EntityIDShader;
+            packet.Geometry = mesh->GetVertexArray();
+            packet.Format = mesh->GetVertexFormat();
+            packet.Transform = mesh->HasQuantizedPositions() ? transform * mesh->GetDequantizeTransform() : transform;
+            packet.Color = glm::vec4(encodedID, 0.0f, 0.0f, 0.0f);
+            packet.VertexCount = mesh->GetVertexCount();
+            packet.IndexCount = mesh->GetLOD(0).IndexCount;
+            packet.FirstIndex = mesh->GetFirstIndex() + mesh->GetLOD(0).FirstIndex;
+            packet.BaseVertex = mesh->GetBaseVertex();
+            packet.Depth = ComputeViewDepth(s_Data->View, transform);
+            s_Data->Queue.Submit(std::move(packet));
+        }
+    }
+
+    void Renderer3D::SubmitCommandList(RenderCommandList& commandList) {
+        for (DrawPacket& packet : commandList.m_Packets)
+            s_Data->Queue.Submit(std::move(packet));
+        for (DrawPacket& packet : commandList.m_Occluders)
+            s_Data->OccluderQueue.Submit(std::move(packet));
+        s_Data->OccluderCount += commandList.m_OccluderCount;
+
+        auto& stats = s_Data->Stats;
+        const auto& recorded = commandList.m_Stats;
+        stats.VisibleObjects += recorded.VisibleObjects;
+        stats.CulledObjects += recorded.CulledObjects;
+        stats.OccludedObjects += recorded.OccludedObjects;
+        stats.VisibleMeshlets += recorded.VisibleMeshlets;
+        stats.FrustumCulledMeshlets += recorded.FrustumCulledMeshlets;
+        stats.BackfaceCulledMeshlets += recorded.BackfaceCulledMeshlets;
+        stats.CommandLists++;
+        commandList.Clear();
+    }
 
-            s_Data->Stats.DrawCalls++;
-            // TODO: Add vertex/triangle count from mesh
+    static uint32_t SelectLOD(const RenderView& view, const AABB& worldBounds, uint32_t currentLevel, uint32_t levelCount) {
+        if (levelCount <= 1 || !worldBounds.IsValid())
+            return 0;
+        float screenSize = LODSelector::ComputeScreenSize(worldBounds, view.CameraPosition, view.ProjectionMatrix);
+        return LODSelector::Select(screenSize, currentLevel, levelCount);
+    }
+
+    static void CullBounds(const RenderView& view, const BoundsSoA& bounds, const uint8_t* cullable,
+                           std::vector<uint8_t>& visibility, Renderer3D::Statistics& stats) {
+        const size_t count = bounds.Size();
+        visibility.resize(count);
+        FrustumCuller::Cull(view.ViewFrustum, bounds, visibility.data());
+
+        for (size_t i = 0; i < count; i++) {
+            if (!cullable[i]) {
+                visibility[i] = 1;
+                continue;
+            }
+            if (visibility[i])
+                stats.VisibleObjects++;
+            else
+                stats.CulledObjects++;
         }
     }
 
+    static bool IsOccluderCandidate(const RenderView& view, const AABB& worldBounds, uint32_t occluderCount) {
+        if (occluderCount >= Renderer3DData::MaxOccluders || !worldBounds.IsValid())
+            return false;
+        if (!view.ViewFrustum.Intersects(worldBounds))
+            return false;
+
+        // Bounding sphere radius over distance approximates the share of the screen it covers
+        float radius = glm::length(worldBounds.GetExtents());
+        float distance = glm::length(worldBounds.GetCenter() - view.CameraPosition);
+        return radius >= Renderer3DData::OccluderMinScreenSize * distance;
+    }
+
+    void RenderCommandList::Begin(const RenderView& view) {
+        m_View = view;
+        Clear();
+    }
+
+    void RenderCommandList::DrawModel(const Ref<Model>& model, const glm::mat4& transform, const Ref<Material>& material,
+                                      const AABB& worldBounds, uint32_t lod, bool cullOnGPU) {
+        if (!model) return;
+        SubmitModel(*this, m_View, m_Stats, true, model, transform, material, worldBounds, lod, cullOnGPU);
+    }
+
+    void RenderCommandList::DrawCube(const glm::mat4& transform, const glm::vec4& color) {
+        Submit(MakeCubePacket(m_View, transform, color));
+    }
+
+    uint32_t RenderCommandList::SelectLOD(const AABB& worldBounds, uint32_t currentLevel, uint32_t levelCount) const {
+        return ClaudeEngine::SelectLOD(m_View, worldBounds, currentLevel, levelCount);
+    }
+
+    void RenderCommandList::CullBounds(const BoundsSoA& bounds, const uint8_t* cullable, std::vector<uint8_t>& visibility) {
+        ClaudeEngine::CullBounds(m_View, bounds, cullable, visibility, m_Stats);
+    }
+
+    bool RenderCommandList::IsOccluderCandidate(const AABB& worldBounds) const {
+        return ClaudeEngine::IsOccluderCandidate(m_View, worldBounds, m_OccluderCount);
+    }
+
+    // Goes into its own queue, like Renderer3D::DrawOccluder
+    struct OccluderSink {
+        std::vector<DrawPacket>& Packets;
+        void Submit(DrawPacket&& packet) { Packets.push_back(std::move(packet)); }
+    };
+
+    void RenderCommandList::DrawOccluder(const Ref<Model>& model, const glm::mat4& transform, uint32_t lod) {
+        if (!model) return;
+        OccluderSink sink{ m_Occluders };
+        SubmitModel(sink, m_View, m_Stats, false, model, transform, nullptr, AABB(), lod, false);
+        m_OccluderCount++;
+    }
+
+    bool RenderCommandList::IsOccluded(const AABB& worldBounds) {
+        if (!s_Data->CPUOcclusion.IsOccluded(worldBounds))
+            return false;
+        m_Stats.OccludedObjects++;
+        return true;
+    }
+
+    void RenderCommandList::Clear() {
+        m_Packets.clear();
+        m_Occluders.clear();
+        m_OccluderCount = 0;
+        m_Stats = Renderer3D::Statistics();
+    }
+
+    uint32_t Renderer3D::SelectLOD(const AABB& worldBounds, uint32_t currentLevel, uint32_t levelCount) {
+        return ClaudeEngine::SelectLOD(s_Data->View, worldBounds, currentLevel, levelCount);
+    }
+
+    static void ApplyPassState(RenderPass pass) {
+        RenderCommand::SetDepthTest(true);
+        RenderCommand::SetBlend(pass != RenderPass::Opaque);
+    }
+
+    // Same pipeline state and vertex array: the draws can go into one multi-draw call
+    static bool CanShareDraw(const DrawPacket& a, const DrawPacket& b) {
+        return a.Pass == b.Pass
+            && a.ShaderProgram == b.ShaderProgram
+            && a.MaterialInstance == b.MaterialInstance
+            && a.Geometry == b.Geometry;
+    }
+
+    // Same mesh as well: the draws can be instanced
+    static bool CanShareBatch(const DrawPacket& a, const DrawPacket& b) {
+        return CanShareDraw(a, b)
+            && a.FirstIndex == b.FirstIndex
+            && a.BaseVertex == b.BaseVertex
+            && a.IndexCount == b.IndexCount;
+    }
+
+    // Writes one cull record per instance and dispatches the cull pass. Afterwards each GPU-culled
+    // group's visible commands start at its first instance and its draw count is in DrawGroupBuffer.
+    static void CullOnGPU(const RenderQueue& queue) {
+        const auto& entries = queue.GetEntries();
+        const auto& batches = s_Data->Batches;
+        const auto& groups = s_Data->Groups;
+
+        auto* records = (CullRecord*)s_Data->CullRecordBuffer->Allocate(s_Data->InstanceCount * sizeof(CullRecord));
+        auto* drawGroups = (DrawGroup*)s_Data->DrawGroupBuffer->Allocate((uint32_t)groups.size() * sizeof(DrawGroup));
+        s_Data->VisibleCommandBuffer->Allocate(s_Data->InstanceCount * sizeof(DrawIndexedIndirectCommand));
+
+        // The first counter of a segment means the segment was just reopened, so every pass that
+        // counted into it last time has finished; collect those before the memory is reused
+        auto* occluded = (uint32_t*)s_Data->CullStatsBuffer->Allocate(sizeof(uint32_t));
+        const uint32_t segmentSize = s_Data->CullStatsBuffer->GetSegmentSize();
+        const uint32_t offset = s_Data->CullStatsBuffer->GetAllocationOffset();
+        auto& counters = s_Data->OccludedCounters[offset / segmentSize];
+        if (offset % segmentSize == 0) {
+            for (uint32_t* counter : counters)
+                s_Data->Stats.OccludedObjects += *counter;
+            counters.clear();
+        }
+        *occluded = 0;
+        counters.push_back(occluded);
+
+        for (uint32_t groupIndex = 0; groupIndex < (uint32_t)groups.size(); groupIndex++) {
+            const DrawGroupRange& group = groups[groupIndex];
+            drawGroups[groupIndex] = { 0, batches[group.FirstBatch].BaseInstance };
+
+            for (uint32_t batchIndex = group.FirstBatch; batchIndex < group.LastBatch; batchIndex++) {
+                const InstanceBatch& batch = batches[batchIndex];
+                for (uint32_t i = 0; i < batch.InstanceCount; i++) {
+                    const DrawPacket& packet = queue.GetPacket(entries[batch.FirstEntry + i]);
+                    CullRecord& record = records[batch.BaseInstance + i];
+                    record.Batch = batchIndex;
+                    record.Group = group.GPUCulled ? groupIndex : NoCullGroup;
+                    if (packet.GPUCulled) {
+                        record.Center = packet.Bounds.GetCenter();
+                        record.Extents = packet.Bounds.GetExtents();
+                    } else {
+                        record.Center = glm::vec3(0.0f);
+                        record.Extents = glm::vec3(-1.0f);
+                    }
+                }
+            }
+        }
+
+        const Ref<Shader>& shader = s_Data->CullShader;
+        shader->Bind();
+        for (int side = 0; side < Frustum::Count; side++) {
+            const Plane& plane = s_Data->View.ViewFrustum.GetPlane((Frustum::Side)side);
+            shader->SetFloat4(s_Data->FrustumPlaneHandles[side], glm::vec4(plane.Normal, plane.Distance));
+        }
+        shader->SetInt(s_Data->RecordCountHandle, (int)s_Data->InstanceCount);
+        shader->SetInt(s_Data->OcclusionCullingHandle, s_Data->PyramidReady ? 1 : 0);
+        if (s_Data->PyramidReady)
+            s_Data->Pyramid->Bind(0);
+        s_Data->BoundShader = shader.get();
+        s_Data->BoundMaterial = nullptr;
+
+        RenderCommand::DispatchCompute((s_Data->InstanceCount + 63) / 64);
+        RenderCommand::InsertMemoryBarrier(RenderAPI::IndirectCommandBarrier | RenderAPI::StorageBarrier | RenderAPI::ClientMappedBarrier);
+    }
+
+    static void ExecuteBatches(const RenderQueue& queue) {
+        auto& stats = s_Data->Stats;
+        const auto& entries = queue.GetEntries();
+        const auto& batches = s_Data->Batches;
+        auto& groups = s_Data->Groups;
+
+        if (!s_Data->InstanceMapped)
+            return;
+
+        Renderer::GetStreamBuffer()->Bind(StreamBuffer::Usage::Storage, InstanceBinding, s_Data->InstanceAllocation);
+
+        auto* commands = (DrawIndexedIndirectCommand*)s_Data->CommandBuffer->Allocate((uint32_t)batches.size() * sizeof(DrawIndexedIndirectCommand));
+        for (size_t i = 0; i < batches.size(); i++) {
+            const InstanceBatch& batch = batches[i];
+            const DrawPacket& packet = queue.GetPacket(entries[batch.FirstEntry]);
+            commands[i] = { packet.IndexCount, batch.InstanceCount, packet.FirstIndex, packet.BaseVertex, batch.BaseInstance };
+
+            stats.Instances += batch.InstanceCount;
+            stats.Vertices += packet.VertexCount * batch.InstanceCount;
+            stats.Triangles += (packet.IndexCount / 3) * batch.InstanceCount;
+        }
+        stats.IndirectCommands += (uint32_t)batches.size();
+
+        // Consecutive batches with the same state become one multi-draw. Only the opaque pass is
+        // culled on the GPU; the atomics in the cull pass would break back-to-front order.
+        const bool gpuCulling = Renderer3D::IsGPUCullingActive();
+        bool anyGPUCulled = false;
+        groups.clear();
+        const uint32_t batchCount = (uint32_t)batches.size();
+        uint32_t first = 0;
+        while (first < batchCount) {
+            const DrawPacket& packet = queue.GetPacket(entries[batches[first].FirstEntry]);
+
+            uint32_t last = first + 1;
+            uint32_t instanceCount = batches[first].InstanceCount;
+            while (last < batchCount && CanShareDraw(packet, queue.GetPacket(entries[batches[last].FirstEntry])))
+                instanceCount += batches[last++].InstanceCount;
+
+            bool gpuCulled = gpuCulling && packet.Pass == RenderPass::Opaque;
+            anyGPUCulled |= gpuCulled;
+            groups.push_back({ first, last, instanceCount, gpuCulled });
+            first = last;
+        }
+
+        if (anyGPUCulled)
+            CullOnGPU(queue);
+
+        for (uint32_t groupIndex = 0; groupIndex < (uint32_t)groups.size(); groupIndex++) {
+            const DrawGroupRange& group = groups[groupIndex];
+            const DrawPacket& packet = queue.GetPacket(entries[batches[group.FirstBatch].FirstEntry]);
+
+            if (!s_Data->PassApplied || packet.Pass != s_Data->CurrentPass) {
+                ApplyPassState(packet.Pass);
+                s_Data->CurrentPass = packet.Pass;
+                s_Data->PassApplied = true;
+            }
+
+            // Materials draw with the variant for their keywords. Programs still compiling draw flat
+            // with the fallback, without their material, and so do programs that failed
+            Material* material = packet.MaterialInstance.get();
+            Shader* shader = material ? material->GetVariant() : packet.ShaderProgram.get();
+            if (!IsShaderReady(*shader)) {
+                shader = s_Data->FallbackShader.get();
+                material = nullptr;
+                stats.FallbackDraws++;
+            }
+
+            // Material::Bind also binds its shader
+            Shader* previousShader = s_Data->BoundShader;
+            if (material && material != s_Data->BoundMaterial) {
+                material->Bind();
+                s_Data->BoundMaterial = material;
+                stats.MaterialBinds++;
+                s_Data->BoundShader = shader;
+                stats.ShaderBinds++;
+            } else {
+                if (material)
+                    stats.StateChangesAvoided++;
+
+                if (shader != s_Data->BoundShader) {
+                    s_Data->BoundShader = shader;
+                    s_Data->BoundShader->Bind();
+                    s_Data->BoundMaterial = nullptr;
+                    stats.ShaderBinds++;
+                } else {
+                    stats.StateChangesAvoided++;
+                }
+            }
+
+            if (packet.Geometry.get() != s_Data->BoundVertexArray) {
+                s_Data->BoundVertexArray = packet.Geometry.get();
+                s_Data->BoundVertexArray->Bind();
+                stats.VertexArrayBinds++;
+                s_Data->BoundShader->SetInt(s_Data->VertexFormatHandle, (int)packet.Format);
+            } else {
+                stats.StateChangesAvoided++;
+                if (s_Data->BoundShader != previousShader)
+                    s_Data->BoundShader->SetInt(s_Data->VertexFormatHandle, (int)packet.Format);
+            }
+
+            if (group.GPUCulled) {
+                // One command per surviving instance, placed from the group's first instance on
+                RenderCommand::DrawIndexedIndirectCount(packet.Geometry, s_Data->VisibleCommandBuffer, batches[group.FirstBatch].BaseInstance,
+                                                        s_Data->DrawGroupBuffer, groupIndex * sizeof(DrawGroup), group.InstanceCount);
+            } else {
+                RenderCommand::DrawIndexedIndirect(packet.Geometry, s_Data->CommandBuffer, group.FirstBatch, group.LastBatch - group.FirstBatch);
+            }
+            stats.DrawCalls++;
+        }
+
+        s_Data->InstanceMapped = nullptr;
+
+        s_Data->Batches.clear();
+        s_Data->InstanceCount = 0;
+    }
+
+    static void FlushQueue(RenderQueue& queue) {
+        if (queue.Empty())
+            return;
+
+        queue.Sort();
+
+        s_Data->Stats.SubmittedPackets += (uint32_t)queue.Size();
+        s_Data->PassApplied = false;
+        s_Data->BoundShader = nullptr;
+        s_Data->BoundMaterial = nullptr;
+        s_Data->BoundVertexArray = nullptr;
+
+        // Sorting puts identical mesh+material packets next to each other, so batches are runs
+        const auto& entries = queue.GetEntries();
+        const uint32_t entryCount = (uint32_t)entries.size();
+        uint32_t first = 0;
+        while (first < entryCount) {
+            const DrawPacket& packet = queue.GetPacket(entries[first]);
+
+            uint32_t last = first + 1;
+            while (last < entryCount && last - first < Renderer3DData::MaxInstances
+                   && CanShareBatch(packet, queue.GetPacket(entries[last])))
+                last++;
+
+            uint32_t count = last - first;
+            if (s_Data->InstanceCount + count > s_Data->InstanceCapacity)
+                ExecuteBatches(queue);
+
+            if (!s_Data->InstanceMapped) {
+                // Only as much as the rest of the queue can fill, so small frames take little of the ring
+                s_Data->InstanceCapacity = std::min(entryCount - first, Renderer3DData::MaxInstances);
+                s_Data->InstanceAllocation = Renderer::GetStreamBuffer()->Allocate(
+                    s_Data->InstanceCapacity * sizeof(InstanceData), StreamBuffer::Usage::Storage);
+                s_Data->InstanceMapped = (InstanceData*)s_Data->InstanceAllocation.Data;
+            }
+
+            s_Data->Batches.push_back({ first, count, s_Data->InstanceCount });
+            for (uint32_t i = first; i < last; i++) {
+                const DrawPacket& instance = queue.GetPacket(entries[i]);
+                s_Data->InstanceMapped[s_Data->InstanceCount++] = { instance.Transform, instance.Color };
+            }
+
+            first = last;
+        }
+
+        ExecuteBatches(queue);
+
+        // Leave blending off as the immediate-mode grid used to
+        RenderCommand::SetBlend(false);
+
+        queue.Clear();
+    }
+
+    void Renderer3D::Flush() {
+        FlushQueue(s_Data->Queue);
+    }
+
     void Renderer3D::DrawGizmo(const glm::mat4& transform, int gizmoOperation, int gizmoMode) {
         // Gizmos are drawn by ImGuizmo directly in ImGui context
         // This is just a placeholder
     }
 
+    bool Renderer3D::IsVisible(const AABB& worldBounds) {
+        if (s_Data->View.ViewFrustum.Intersects(worldBounds)) {
+            s_Data->Stats.VisibleObjects++;
+            return true;
+        }
+        s_Data->Stats.CulledObjects++;
+        return false;
+    }
+
+    void Renderer3D::CullBounds(const BoundsSoA& bounds, const uint8_t* cullable, std::vector<uint8_t>& visibility) {
+        ClaudeEngine::CullBounds(s_Data->View, bounds, cullable, visibility, s_Data->Stats);
+    }
+
+    const std::vector<std::string>& Renderer3D::GetFailedShaders() {
+        return s_Data->FailedShaders;
+    }
+
+    const Frustum& Renderer3D::GetFrustum() {
+        return s_Data->View.ViewFrustum;
+    }
+
+    void Renderer3D::SetMeshletCulling(bool enabled) {
+        s_Data->MeshletCullingEnabled = enabled;
+    }
+
+    bool Renderer3D::IsMeshletCullingEnabled() {
+        return s_Data->MeshletCullingEnabled;
+    }
+
+    void Renderer3D::SetGPUCulling(bool enabled) {
+        s_Data->GPUCullingEnabled = enabled;
+        // Counts of passes from before the switch would show up frames later
+        for (auto& counters : s_Data->OccludedCounters)
+            counters.clear();
+    }
+
+    bool Renderer3D::IsGPUCullingSupported() {
+        return s_Data->GPUCullingSupported;
+    }
+
+    bool Renderer3D::IsGPUCullingActive() {
+        return s_Data->GPUCullingEnabled && s_Data->GPUCullingSupported;
+    }
+
+    void Renderer3D::SetOcclusionCulling(bool enabled) {
+        s_Data->OcclusionEnabled = enabled;
+        // A later re-enable must not test against depth from long ago
+        if (!enabled)
+            s_Data->CPUOcclusion.Clear();
+        for (auto& counters : s_Data->OccludedCounters)
+            counters.clear();
+    }
+
+    bool Renderer3D::IsOcclusionCullingSupported() {
+        return s_Data->OcclusionSupported;
+    }
+
+    bool Renderer3D::IsOcclusionCullingActive() {
+        return s_Data->OcclusionEnabled && s_Data->OcclusionSupported;
+    }
+
+    bool Renderer3D::IsOccluderCandidate(const AABB& worldBounds) {
+        return ClaudeEngine::IsOccluderCandidate(s_Data->View, worldBounds, s_Data->OccluderCount);
+    }
+
+    void Renderer3D::DrawOccluder(const Ref<Model>& model, const glm::mat4& transform, uint32_t lod) {
+        if (!model) return;
+        SubmitModel(s_Data->OccluderQueue, s_Data->View, s_Data->Stats, false, model, transform, nullptr, AABB(), lod, false);
+        s_Data->OccluderCount++;
+    }
+
+    void Renderer3D::BuildOcclusionPyramid(const Ref<Framebuffer>& framebuffer) {
+        if (!IsOcclusionCullingActive())
+            return;
+
+        s_Data->Stats.Occluders = s_Data->OccluderCount;
+        if (s_Data->OccluderQueue.Empty()) {
+            // Nothing can hide anything this frame
+            s_Data->CPUOcclusion.Clear();
+            return;
+        }
+
+        // Depth pre-pass; the main pass redraws the occluders at equal depth
+        RenderCommand::SetColorWrite(false);
+        FlushQueue(s_Data->OccluderQueue);
+        RenderCommand::SetColorWrite(true);
+
+        s_Data->PyramidReady = s_Data->Pyramid->Build(framebuffer, s_Data->View.ViewProjectionMatrix);
+        s_Data->BoundShader = nullptr;
+        s_Data->BoundMaterial = nullptr;
+
+        if (s_Data->Pyramid->PollReadback(s_Data->PyramidReadback))
+            s_Data->CPUOcclusion.Update(s_Data->PyramidReadback);
+    }
+
+    bool Renderer3D::IsOccluded(const AABB& worldBounds) {
+        if (!s_Data->CPUOcclusion.IsOccluded(worldBounds))
+            return false;
+        s_Data->Stats.OccludedObjects++;
+        return true;
+    }
+
     Renderer3D::Statistics Renderer3D::GetStats() {
+        RenderAPI::StateStatistics stateStats = RenderCommand::GetStateStatistics();
+        s_Data->Stats.StateCallsIssued = stateStats.IssuedCalls;
+        s_Data->Stats.StateCallsFiltered = stateStats.FilteredCalls;
         return s_Data->Stats;
     }
 
     void Renderer3D::ResetStats() {
+        RenderCommand::ResetStateStatistics();
         s_Data->Stats.DrawCalls = 0;
+        s_Data->Stats.IndirectCommands = 0;
         s_Data->Stats.Vertices = 0;
         s_Data->Stats.Triangles = 0;
+        s_Data->Stats.Instances = 0;
+        s_Data->Stats.SubmittedPackets = 0;
+        s_Data->Stats.CommandLists = 0;
+        s_Data->Stats.FallbackDraws = 0;
+        s_Data->Stats.ShaderBinds = 0;
+        s_Data->Stats.MaterialBinds = 0;
+        s_Data->Stats.VertexArrayBinds = 0;
+        s_Data->Stats.StateChangesAvoided = 0;
+        s_Data->Stats.VisibleObjects = 0;
+        s_Data->Stats.CulledObjects = 0;
+        s_Data->Stats.Occluders = 0;
+        s_Data->Stats.OccludedObjects = 0;
+        s_Data->Stats.VisibleMeshlets = 0;
+        s_Data->Stats.FrustumCulledMeshlets = 0;
+        s_Data->Stats.BackfaceCulledMeshlets = 0;
     }
 
     // ==================== INITIALIZATION ====================
@@ -139,12 +887,11 @@ namespace ClaudeEngine {
         
         // Load grid shader from file
         CE_INFO("Renderer3D: Loading grid shader from assets/shaders/Grid.glsl...");
-        s_Data->GridShader = Shader::Create("assets/shaders/Grid.glsl");
+        s_Data->GridShader = Shader::CreateAsync("assets/shaders/Grid.glsl");
         if (!s_Data->GridShader) {
             CE_ERROR("Renderer3D: Failed to load grid shader from file!");
             return;
         }
-        CE_INFO("Renderer3D: Grid shader loaded successfully");
 
         // Fullscreen quad for grid
         float gridVertices[] = {
@@ -174,53 +921,113 @@ namespace ClaudeEngine {
         
         // Load basic shader from file
         CE_INFO("Renderer3D: Loading basic color shader from assets/shaders/BasicColor.glsl...");
-        s_Data->BasicShader = Shader::Create("assets/shaders/BasicColor.glsl");
+        s_Data->BasicShader = Shader::CreateAsync("assets/shaders/BasicColor.glsl");
         if (!s_Data->BasicShader) {
             CE_ERROR("Renderer3D: Failed to load basic color shader from file!");
             return;
         }
-        CE_INFO("Renderer3D: Basic color shader loaded successfully");
-
-        // Cube vertices (simple cube)
-        float cubeVertices[] = {
-            // Front
-            -0.5f, -0.5f,  0.5f,
-             0.5f, -0.5f,  0.5f,
-             0.5f,  0.5f,  0.5f,
-            -0.5f,  0.5f,  0.5f,
-            // Back
-            -0.5f, -0.5f, -0.5f,
-             0.5f, -0.5f, -0.5f,
-             0.5f,  0.5f, -0.5f,
-            -0.5f,  0.5f, -0.5f
-        };
 
-        uint32_t cubeIndices[] = {
-            // Front
-            0, 1, 2, 2, 3, 0,
-            // Back
-            5, 4, 7, 7, 6, 5,
-            // Left
-            4, 0, 3, 3, 7, 4,
-            // Right
-            1, 5, 6, 6, 2, 1,
-            // Top
-            3, 2, 6, 6, 7, 3,
-            // Bottom
-            4, 5, 1, 1, 0, 4
-        };
-
-        s_Data->CubeVAO = VertexArray::Create();
-        Ref<VertexBuffer> cubeVB = VertexBuffer::Create(cubeVertices, sizeof(cubeVertices));
-        cubeVB->SetLayout({
-            { ShaderDataType::Float3, "a_Position" }
-        });
-        s_Data->CubeVAO->AddVertexBuffer(cubeVB);
-
-        Ref<IndexBuffer> cubeIB = IndexBuffer::Create(cubeIndices, sizeof(cubeIndices) / sizeof(uint32_t));
-        s_Data->CubeVAO->SetIndexBuffer(cubeIB);
+        // Share the Mesh vertex layout so the cube can be instanced like any model
+        s_Data->CubeMesh = MeshPrimitives::CreateCube(1.0f);
+        s_Data->CubeVAO = s_Data->CubeMesh->GetVertexArray();
+        s_Data->VertexFormatHandle = Shader::GetUniformHandle("u_VertexFormat");
         
         CE_INFO("Renderer3D: Cube primitive initialized successfully");
     }
 
+    void Renderer3D::InitFallbackShader() {
+        // Position and instance color only, so it works for every vertex format and packet
+        const std::string vertexSrc = R"(
+            #version 460 core
+
+            layout(location = 0) in vec3 a_Position;
+
+            layout(std140, binding = 0) uniform Camera {
+                mat4 u_ViewProjection;
+            };
+
+            struct InstanceData {
+                mat4 Transform;
+                vec4 Color;
+            };
+
+            layout(std430, binding = 1) readonly buffer Instances {
+                InstanceData u_Instances[];
+            };
+
+            out vec4 v_Color;
+
+            void main() {
+                InstanceData instance = u_Instances[gl_BaseInstance + gl_InstanceID];
+                v_Color = instance.Color;
+                gl_Position = u_ViewProjection * instance.Transform * vec4(a_Position, 1.0);
+            }
+        )";
+
+        const std::string fragmentSrc = R"(
+            #version 460 core
+
+            layout(location = 0) out vec4 FragColor;
+
+            in vec4 v_Color;
+
+            void main() {
+                FragColor = v_Color;
+            }
+        )";
+
+        s_Data->FallbackShader = Shader::Create("Fallback", vertexSrc, fragmentSrc);
+    }
+
+    void Renderer3D::InitEntityIDs() {
+        // Compiled up front: the fallback shader cannot write integer IDs
+        s_Data->EntityIDShader = Shader::Create("assets/shaders/EntityID.glsl");
+        if (!s_Data->EntityIDShader || !s_Data->EntityIDShader->IsReady())
+            CE_ERROR("Renderer3D: Failed to load entity ID shader, framebuffer picking unavailable");
+    }
+
+    void Renderer3D::InitInstancing() {
+        s_Data->CommandBuffer = StorageBuffer::Create(Renderer3DData::FrameInstances * sizeof(DrawIndexedIndirectCommand),
+                                                      Renderer3DData::InstanceSegments, IndirectBinding);
+    }
+
+    void Renderer3D::InitGPUCulling() {
+        const RenderAPI::Capabilities& caps = RenderCommand::GetCapabilities();
+        if (!caps.ComputeShaders || !caps.IndirectCount) {
+            CE_WARN("Renderer3D: GPU culling unavailable (compute: {0}, indirect count: {1}), using CPU culling",
+                    caps.ComputeShaders, caps.IndirectCount);
+            return;
+        }
+
+        s_Data->CullShader = Shader::Create("assets/shaders/FrustumCull.glsl");
+        if (!s_Data->CullShader) {
+            CE_ERROR("Renderer3D: Failed to load GPU culling shader, using CPU culling");
+            return;
+        }
+
+        for (int side = 0; side < Frustum::Count; side++)
+            s_Data->FrustumPlaneHandles[side] = Shader::GetUniformHandle("u_FrustumPlanes[" + std::to_string(side) + "]");
+        s_Data->RecordCountHandle = Shader::GetUniformHandle("u_RecordCount");
+        s_Data->OcclusionCullingHandle = Shader::GetUniformHandle("u_OcclusionCulling");
+
+        s_Data->CullRecordBuffer = StorageBuffer::Create(Renderer3DData::FrameInstances * sizeof(CullRecord),
+                                                         Renderer3DData::InstanceSegments, CullRecordBinding);
+        s_Data->DrawGroupBuffer = StorageBuffer::Create(Renderer3DData::FrameInstances * sizeof(DrawGroup),
+                                                        Renderer3DData::InstanceSegments, DrawGroupBinding);
+        s_Data->VisibleCommandBuffer = StorageBuffer::CreateGPUOnly(Renderer3DData::MaxInstances * sizeof(DrawIndexedIndirectCommand),
+                                                                    VisibleCommandBinding);
+        s_Data->CullStatsBuffer = StorageBuffer::Create(Renderer3DData::FrameCullPasses * 256, Renderer3DData::InstanceSegments, CullStatsBinding);
+        s_Data->GPUCullingSupported = true;
+    }
+
+    void Renderer3D::InitOcclusionCulling() {
+        if (!RenderCommand::GetCapabilities().ComputeShaders) {
+            CE_WARN("Renderer3D: Occlusion culling unavailable without compute shaders");
+            return;
+        }
+
+        s_Data->Pyramid = DepthPyramid::Create();
+        s_Data->OcclusionSupported = s_Data->Pyramid != nullptr;
+    }
+
 }
@@ -2,8 +2,49 @@
 #include "ClaudeEngine/Renderer/Renderer.h"
 #include "ClaudeEngine/Platform/OpenGL/OpenGLShader.h"
 
+#include <vector>
+
 namespace ClaudeEngine {
 
+    // Global uniform name table; handles index into Names. Function-local so handles
+    // can be resolved from static initializers in other translation units
+    struct UniformNameTable {
+        std::unordered_map<std::string, UniformHandle> Handles;
+        std::vector<std::string> Names;
+    };
+
+    static UniformNameTable& GetUniformNameTable() {
+        static UniformNameTable table;
+        return table;
+    }
+
+    UniformHandle Shader::GetUniformHandle(const std::string& name) {
+        UniformNameTable& table = GetUniformNameTable();
+        auto it = table.Handles.find(name);
+        if (it != table.Handles.end())
+            return it->second;
+
+        UniformHandle handle = (UniformHandle)table.Names.size();
+        table.Names.push_back(name);
+        table.Handles.emplace(name, handle);
+        return handle;
+    }
+
+    const std::string& Shader::GetUniformName(UniformHandle handle) {
+        UniformNameTable& table = GetUniformNameTable();
+        CE_CORE_ASSERT(handle < table.Names.size(), "Invalid uniform handle!");
+        return table.Names[handle];
+    }
+
+    ShaderFeatureMask Shader::GetFeatureMask(const std::string& feature) const {
+        const auto& features = GetFeatures();
+        for (size_t i = 0; i < features.size(); i++) {
+            if (features[i] == feature)
+                return 1u << i;
+        }
+        return 0;
+    }
+
     Ref<Shader> Shader::Create(const std::string& filepath) {
         switch (Renderer::GetAPI()) {
             case RenderAPI::API::None:    
@@ -17,6 +58,19 @@ namespace ClaudeEngine {
         return nullptr;
     }
 
+    Ref<Shader> Shader::CreateAsync(const std::string& filepath) {
+        switch (Renderer::GetAPI()) {
+            case RenderAPI::API::None:
+                CE_CORE_ASSERT(false, "RenderAPI::None is not supported!");
+                return nullptr;
+            case RenderAPI::API::OpenGL:
+                return CreateRef<OpenGLShader>(filepath, true);
+        }
+
+        CE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
     Ref<Shader> Shader::Create(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc) {
         switch (Renderer::GetAPI()) {
             case RenderAPI::API::None:    
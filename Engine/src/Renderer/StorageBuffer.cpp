@@ -0,0 +1,43 @@
+#include "ClaudeEngine/Renderer/StorageBuffer.h"
+#include "ClaudeEngine/Renderer/Renderer.h"
+#include "ClaudeEngine/Platform/OpenGL/OpenGLStorageBuffer.h"
+
+namespace ClaudeEngine {
+
+    Ref<StorageBuffer> StorageBuffer::Create(uint32_t segmentSize, uint32_t segmentCount, uint32_t binding) {
+        switch (Renderer::GetAPI()) {
+            case RenderAPI::API::None:    
+                CE_CORE_ASSERT(false, "RenderAPI::None is not supported!");
+                return nullptr;
+            case RenderAPI::API::OpenGL:  
+                return CreateRef<OpenGLStorageBuffer>(segmentSize, segmentCount, binding);
+        }
+
+        CE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+    Ref<StorageBuffer> StorageBuffer::CreateGPUOnly(uint32_t size, uint32_t binding) {
+        switch (Renderer::GetAPI()) {
+            case RenderAPI::API::None:    
+                CE_CORE_ASSERT(false, "RenderAPI::None is not supported!");
+                return nullptr;
+            case RenderAPI::API::OpenGL:  
+                return CreateRef<OpenGLStorageBuffer>(size, binding);
+        }
+
+        CE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+    void StorageBuffer::EndFrame() {
+        switch (Renderer::GetAPI()) {
+            case RenderAPI::API::None:
+                return;
+            case RenderAPI::API::OpenGL:
+                OpenGLStorageBuffer::EndFrameAll();
+                return;
+        }
+    }
+
+}
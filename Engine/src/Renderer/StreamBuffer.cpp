@@ -0,0 +1,20 @@
+#include "ClaudeEngine/Renderer/StreamBuffer.h"
+#include "ClaudeEngine/Renderer/Renderer.h"
+#include "ClaudeEngine/Platform/OpenGL/OpenGLStreamBuffer.h"
+
+namespace ClaudeEngine {
+
+    Ref<StreamBuffer> StreamBuffer::Create(uint32_t size) {
+        switch (Renderer::GetAPI()) {
+            case RenderAPI::API::None:    
+                CE_CORE_ASSERT(false, "RenderAPI::None is not supported!");
+                return nullptr;
+            case RenderAPI::API::OpenGL:  
+                return CreateRef<OpenGLStreamBuffer>(size);
+        }
+
+        CE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+}
@@ -0,0 +1,212 @@
+#include "ClaudeEngine/Renderer/TriangleBVH.h"
+#include "ClaudeEngine/Renderer/Mesh.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ClaudeEngine {
+
+    const AABB TriangleBVH::s_EmptyBounds;
+
+    TriangleBVH::TriangleBVH(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices) {
+        const uint32_t triangleCount = (uint32_t)(indices.size() / 3);
+        if (triangleCount == 0)
+            return;
+
+        m_Triangles.reserve(triangleCount);
+        std::vector<glm::vec3> centroids;
+        centroids.reserve(triangleCount);
+        for (uint32_t t = 0; t < triangleCount; t++) {
+            const glm::vec3& p0 = vertices[indices[t * 3]].Position;
+            const glm::vec3& p1 = vertices[indices[t * 3 + 1]].Position;
+            const glm::vec3& p2 = vertices[indices[t * 3 + 2]].Position;
+            m_Triangles.push_back({ p0, p1 - p0, p2 - p0, t });
+            centroids.push_back((p0 + p1 + p2) * (1.0f / 3.0f));
+        }
+
+        // At most 2n - 1 nodes; reserving keeps node references stable while splitting
+        m_Nodes.reserve(triangleCount * 2);
+        m_Nodes.emplace_back();
+        m_Nodes[0].First = 0;
+        m_Nodes[0].Count = triangleCount;
+
+        std::vector<uint32_t> stack;
+        stack.push_back(0);
+        while (!stack.empty()) {
+            uint32_t nodeIndex = stack.back();
+            stack.pop_back();
+
+            Node& node = m_Nodes[nodeIndex];
+            for (uint32_t i = node.First; i < node.First + node.Count; i++) {
+                const Triangle& triangle = m_Triangles[i];
+                node.Bounds.Expand(triangle.P0);
+                node.Bounds.Expand(triangle.P0 + triangle.Edge1);
+                node.Bounds.Expand(triangle.P0 + triangle.Edge2);
+            }
+
+            Subdivide(nodeIndex, centroids);
+            if (m_Nodes[nodeIndex].Count == 0) {
+                stack.push_back(m_Nodes[nodeIndex].First);
+                stack.push_back(m_Nodes[nodeIndex].First + 1);
+            }
+        }
+    }
+
+    void TriangleBVH::Subdivide(uint32_t nodeIndex, std::vector<glm::vec3>& centroids) {
+        Node& node = m_Nodes[nodeIndex];
+        if (node.Count <= MaxLeafTriangles)
+            return;
+
+        AABB centroidBounds;
+        for (uint32_t i = node.First; i < node.First + node.Count; i++)
+            centroidBounds.Expand(centroids[i]);
+
+        // Binned surface area heuristic over all three axes
+        struct Bin {
+            AABB Bounds;
+            uint32_t Count = 0;
+        };
+        int bestAxis = -1;
+        uint32_t bestSplit = 0;
+        float bestCost = (float)node.Count * node.Bounds.GetHalfArea();
+        for (int axis = 0; axis < 3; axis++) {
+            float minimum = centroidBounds.Min[axis];
+            float extent = centroidBounds.Max[axis] - minimum;
+            if (extent <= 0.0f)
+                continue;
+
+            Bin bins[BinCount];
+            float scale = BinCount / extent;
+            for (uint32_t i = node.First; i < node.First + node.Count; i++) {
+                uint32_t bin = std::min(BinCount - 1, (uint32_t)((centroids[i][axis] - minimum) * scale));
+                const Triangle& triangle = m_Triangles[i];
+                bins[bin].Count++;
+                bins[bin].Bounds.Expand(triangle.P0);
+                bins[bin].Bounds.Expand(triangle.P0 + triangle.Edge1);
+                bins[bin].Bounds.Expand(triangle.P0 + triangle.Edge2);
+            }
+
+            // Sweep from the right to get the cost of everything past each plane
+            float rightCost[BinCount];
+            AABB rightBounds;
+            uint32_t rightCount = 0;
+            for (uint32_t b = BinCount - 1; b > 0; b--) {
+                rightBounds.Expand(bins[b].Bounds);
+                rightCount += bins[b].Count;
+                rightCost[b] = rightCount ? rightCount * rightBounds.GetHalfArea() : 0.0f;
+            }
+
+            AABB leftBounds;
+            uint32_t leftCount = 0;
+            for (uint32_t b = 0; b + 1 < BinCount; b++) {
+                leftBounds.Expand(bins[b].Bounds);
+                leftCount += bins[b].Count;
+                if (leftCount == 0 || leftCount == node.Count)
+                    continue;
+                float cost = leftCount * leftBounds.GetHalfArea() + rightCost[b + 1];
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = b + 1;
+                }
+            }
+        }
+
+        if (bestAxis < 0)
+            return;
+
+        const float minimum = centroidBounds.Min[bestAxis];
+        const float scale = BinCount / (centroidBounds.Max[bestAxis] - minimum);
+        uint32_t left = node.First;
+        uint32_t right = node.First + node.Count;
+        while (left < right) {
+            uint32_t bin = std::min(BinCount - 1, (uint32_t)((centroids[left][bestAxis] - minimum) * scale));
+            if (bin < bestSplit) {
+                left++;
+            } else {
+                right--;
+                std::swap(m_Triangles[left], m_Triangles[right]);
+                std::swap(centroids[left], centroids[right]);
+            }
+        }
+
+        uint32_t leftCount = left - node.First;
+        uint32_t childIndex = (uint32_t)m_Nodes.size();
+        Node leftChild, rightChild;
+        leftChild.First = node.First;
+        leftChild.Count = leftCount;
+        rightChild.First = left;
+        rightChild.Count = node.Count - leftCount;
+        node.First = childIndex;
+        node.Count = 0;
+        m_Nodes.push_back(leftChild);
+        m_Nodes.push_back(rightChild);
+    }
+
+    bool TriangleBVH::Intersect(const Ray& ray, float maxDistance, RayHit& hit) const {
+        if (m_Nodes.empty())
+            return false;
+
+        float closest = maxDistance;
+        bool found = false;
+
+        float entry;
+        if (!m_Nodes[0].Bounds.Intersects(ray, closest, entry))
+            return false;
+
+        std::vector<uint32_t> stack;
+        stack.reserve(64);
+        stack.push_back(0);
+        while (!stack.empty()) {
+            const Node& node = m_Nodes[stack.back()];
+            stack.pop_back();
+
+            if (node.Count > 0) {
+                // Moller-Trumbore
+                for (uint32_t i = node.First; i < node.First + node.Count; i++) {
+                    const Triangle& triangle = m_Triangles[i];
+                    glm::vec3 p = glm::cross(ray.Direction, triangle.Edge2);
+                    float determinant = glm::dot(triangle.Edge1, p);
+                    if (std::fabs(determinant) < 1e-12f)
+                        continue;
+
+                    float inverse = 1.0f / determinant;
+                    glm::vec3 s = ray.Origin - triangle.P0;
+                    float u = glm::dot(s, p) * inverse;
+                    if (u < 0.0f || u > 1.0f)
+                        continue;
+                    glm::vec3 q = glm::cross(s, triangle.Edge1);
+                    float v = glm::dot(ray.Direction, q) * inverse;
+                    if (v < 0.0f || u + v > 1.0f)
+                        continue;
+
+                    float t = glm::dot(triangle.Edge2, q) * inverse;
+                    if (t >= 0.0f && t < closest) {
+                        closest = t;
+                        hit.Distance = t;
+                        hit.Triangle = triangle.Index;
+                        hit.Barycentrics = glm::vec2(u, v);
+                        found = true;
+                    }
+                }
+                continue;
+            }
+
+            // Nearer child goes on top so its hits clip the other one
+            float nearDistance, farDistance;
+            uint32_t nearChild = node.First, farChild = node.First + 1;
+            bool nearHit = m_Nodes[nearChild].Bounds.Intersects(ray, closest, nearDistance);
+            bool farHit = m_Nodes[farChild].Bounds.Intersects(ray, closest, farDistance);
+            if (nearHit && farHit && farDistance < nearDistance) {
+                std::swap(nearChild, farChild);
+                std::swap(nearHit, farHit);
+            }
+            if (farHit)
+                stack.push_back(farChild);
+            if (nearHit)
+                stack.push_back(nearChild);
+        }
+
+        return found;
+    }
+
+}
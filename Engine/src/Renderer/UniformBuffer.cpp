@@ -0,0 +1,20 @@
+#include "ClaudeEngine/Renderer/UniformBuffer.h"
+#include "ClaudeEngine/Renderer/Renderer.h"
+#include "ClaudeEngine/Platform/OpenGL/OpenGLUniformBuffer.h"
+
+namespace ClaudeEngine {
+
+    Ref<UniformBuffer> UniformBuffer::Create(uint32_t size, uint32_t binding) {
+        switch (Renderer::GetAPI()) {
+            case RenderAPI::API::None:    
+                CE_CORE_ASSERT(false, "RenderAPI::None is not supported!");
+                return nullptr;
+            case RenderAPI::API::OpenGL:  
+                return CreateRef<OpenGLUniformBuffer>(size, binding);
+        }
+
+        CE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+}
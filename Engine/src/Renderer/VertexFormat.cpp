@@ -0,0 +1,179 @@
+#include "ClaudeEngine/Renderer/VertexFormat.h"
+#include "ClaudeEngine/Renderer/Mesh.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace ClaudeEngine {
+
+    static_assert(sizeof(PackedVertex) == 28, "PackedVertex must match its buffer layout");
+    static_assert(sizeof(QuantizedVertex) == 20, "QuantizedVertex must match its buffer layout");
+
+    static int16_t ToSnorm16(float value) {
+        return (int16_t)std::lround(std::max(-1.0f, std::min(value, 1.0f)) * 32767.0f);
+    }
+
+    // Round to nearest; values past the half range become infinity
+    static uint16_t ToHalf(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        uint32_t sign = (bits >> 16) & 0x8000;
+        int32_t exponent = (int32_t)((bits >> 23) & 0xFF) - 127 + 15;
+        uint32_t mantissa = bits & 0x7FFFFF;
+
+        if (((bits >> 23) & 0xFF) == 0xFF)
+            return (uint16_t)(sign | 0x7C00 | (mantissa ? 0x200 : 0));
+        if (exponent >= 31)
+            return (uint16_t)(sign | 0x7C00);
+        if (exponent <= 0) {
+            // Subnormal half, or zero once even the leading bit is shifted out
+            if (exponent < -10)
+                return (uint16_t)sign;
+            mantissa |= 0x800000;
+            uint32_t shift = (uint32_t)(14 - exponent);
+            uint32_t half = mantissa >> shift;
+            if ((mantissa >> (shift - 1)) & 1)
+                half++;
+            return (uint16_t)(sign | half);
+        }
+
+        // A carry out of the mantissa correctly bumps the exponent
+        uint32_t half = sign | ((uint32_t)exponent << 10) | (mantissa >> 13);
+        if (mantissa & 0x1000)
+            half++;
+        return (uint16_t)half;
+    }
+
+    // Unit vector onto an octahedron unfolded into [-1, 1]^2
+    static void EncodeOctahedral(const glm::vec3& v, int16_t out[2]) {
+        float sum = std::fabs(v.x) + std::fabs(v.y) + std::fabs(v.z);
+        if (sum <= 0.0f) {
+            out[0] = out[1] = 0;
+            return;
+        }
+
+        float x = v.x / sum, y = v.y / sum;
+        if (v.z < 0.0f) {
+            float foldedX = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+            float foldedY = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+            x = foldedX;
+            y = foldedY;
+        }
+        out[0] = ToSnorm16(x);
+        out[1] = ToSnorm16(y);
+    }
+
+    static float BitangentSign(const Vertex& vertex) {
+        return glm::dot(glm::cross(vertex.Normal, vertex.Tangent), vertex.Bitangent) < 0.0f ? -1.0f : 1.0f;
+    }
+
+    const char* VertexFormatToString(VertexFormat format) {
+        switch (format) {
+            case VertexFormat::Standard:        return "Standard";
+            case VertexFormat::Packed:          return "Packed";
+            case VertexFormat::PackedQuantized: return "Packed + Quantized";
+        }
+        return "Unknown";
+    }
+
+    uint32_t GetVertexFormatStride(VertexFormat format) {
+        switch (format) {
+            case VertexFormat::Standard:        return sizeof(Vertex);
+            case VertexFormat::Packed:          return sizeof(PackedVertex);
+            case VertexFormat::PackedQuantized: return sizeof(QuantizedVertex);
+        }
+        CE_CORE_ASSERT(false, "Unknown VertexFormat!");
+        return 0;
+    }
+
+    BufferLayout GetVertexFormatLayout(VertexFormat format) {
+        switch (format) {
+            case VertexFormat::Standard:
+                return {
+                    { ShaderDataType::Float3, "a_Position" },
+                    { ShaderDataType::Float3, "a_Normal" },
+                    { ShaderDataType::Float2, "a_TexCoords" },
+                    { ShaderDataType::Float3, "a_Tangent" },
+                    { ShaderDataType::Float3, "a_Bitangent" }
+                };
+            case VertexFormat::Packed:
+                return {
+                    { ShaderDataType::Float4, "a_Position" },
+                    { ShaderDataType::Short2, "a_Normal", true },
+                    { ShaderDataType::Half2,  "a_TexCoords" },
+                    { ShaderDataType::Short2, "a_Tangent", true }
+                };
+            case VertexFormat::PackedQuantized:
+                return {
+                    { ShaderDataType::Short4, "a_Position", true },
+                    { ShaderDataType::Short2, "a_Normal", true },
+                    { ShaderDataType::Half2,  "a_TexCoords" },
+                    { ShaderDataType::Short2, "a_Tangent", true }
+                };
+        }
+        CE_CORE_ASSERT(false, "Unknown VertexFormat!");
+        return {};
+    }
+
+    glm::mat4 PackVertices(const std::vector<Vertex>& vertices, VertexFormat format, std::vector<uint8_t>& packed) {
+        glm::mat4 dequantize(1.0f);
+        packed.resize(vertices.size() * GetVertexFormatStride(format));
+
+        switch (format) {
+            case VertexFormat::Standard:
+                if (!vertices.empty())
+                    std::memcpy(packed.data(), vertices.data(), packed.size());
+                break;
+
+            case VertexFormat::Packed: {
+                auto* out = (PackedVertex*)packed.data();
+                for (size_t i = 0; i < vertices.size(); i++) {
+                    const Vertex& vertex = vertices[i];
+                    out[i].Position = glm::vec4(vertex.Position, BitangentSign(vertex));
+                    EncodeOctahedral(vertex.Normal, out[i].Normal);
+                    out[i].TexCoords[0] = ToHalf(vertex.TexCoords.x);
+                    out[i].TexCoords[1] = ToHalf(vertex.TexCoords.y);
+                    EncodeOctahedral(vertex.Tangent, out[i].Tangent);
+                }
+                break;
+            }
+
+            case VertexFormat::PackedQuantized: {
+                glm::vec3 min(0.0f), max(0.0f);
+                if (!vertices.empty())
+                    min = max = vertices[0].Position;
+                for (const Vertex& vertex : vertices) {
+                    min = glm::min(min, vertex.Position);
+                    max = glm::max(max, vertex.Position);
+                }
+
+                // One scale for all axes keeps the dequantization a similarity transform, so
+                // shaders can keep transforming normals with the model matrix
+                glm::vec3 center = (min + max) * 0.5f;
+                glm::vec3 halfSize = (max - min) * 0.5f;
+                float scale = std::max(std::max(halfSize.x, halfSize.y), halfSize.z);
+                float invScale = scale > 0.0f ? 1.0f / scale : 0.0f;
+
+                auto* out = (QuantizedVertex*)packed.data();
+                for (size_t i = 0; i < vertices.size(); i++) {
+                    const Vertex& vertex = vertices[i];
+                    glm::vec3 local = (vertex.Position - center) * invScale;
+                    out[i].Position[0] = ToSnorm16(local.x);
+                    out[i].Position[1] = ToSnorm16(local.y);
+                    out[i].Position[2] = ToSnorm16(local.z);
+                    out[i].Position[3] = ToSnorm16(BitangentSign(vertex));
+                    EncodeOctahedral(vertex.Normal, out[i].Normal);
+                    out[i].TexCoords[0] = ToHalf(vertex.TexCoords.x);
+                    out[i].TexCoords[1] = ToHalf(vertex.TexCoords.y);
+                    EncodeOctahedral(vertex.Tangent, out[i].Tangent);
+                }
+
+                dequantize[0][0] = dequantize[1][1] = dequantize[2][2] = scale;
+                dequantize[3] = glm::vec4(center, 1.0f);
+                break;
+            }
+        }
+        return dequantize;
+    }
+
+}
@@ -0,0 +1,18 @@
+#include "ClaudeEngine/Scene/Components.h"
+#include "ClaudeEngine/Renderer/Model.h"
+
+namespace ClaudeEngine {
+
+    void MeshRendererComponent::CalculateBoundingBox() {
+        if (!ModelAsset)
+            return;
+
+        const AABB& bounds = ModelAsset->GetBoundingBox();
+        if (!bounds.IsValid())
+            return;
+
+        BoundingBoxMin = bounds.Min;
+        BoundingBoxMax = bounds.Max;
+    }
+
+}
@@ -0,0 +1,295 @@
+#include "ClaudeEngine/Scene/DynamicAABBTree.h"
+#include "ClaudeEngine/Core/Core.h"
+#include <algorithm>
+
+namespace ClaudeEngine {
+
+    static AABB Union(const AABB& a, const AABB& b) {
+        return AABB(glm::min(a.Min, b.Min), glm::max(a.Max, b.Max));
+    }
+
+    DynamicAABBTree::DynamicAABBTree(float margin)
+        : m_Margin(margin) {
+    }
+
+    int32_t DynamicAABBTree::AllocateNode() {
+        if (m_FreeList == NullNode) {
+            m_Nodes.emplace_back();
+            m_Nodes.back().Height = 0;
+            return (int32_t)m_Nodes.size() - 1;
+        }
+
+        int32_t nodeID = m_FreeList;
+        m_FreeList = m_Nodes[nodeID].Next;
+
+        Node& node = m_Nodes[nodeID];
+        node.Parent = NullNode;
+        node.Child1 = NullNode;
+        node.Child2 = NullNode;
+        node.Height = 0;
+        node.UserData = 0;
+        return nodeID;
+    }
+
+    void DynamicAABBTree::FreeNode(int32_t nodeID) {
+        m_Nodes[nodeID].Next = m_FreeList;
+        m_Nodes[nodeID].Height = -1;
+        m_FreeList = nodeID;
+    }
+
+    int32_t DynamicAABBTree::CreateProxy(const AABB& box, uint32_t userData) {
+        int32_t proxyID = AllocateNode();
+
+        glm::vec3 margin(m_Margin);
+        m_Nodes[proxyID].Box = AABB(box.Min - margin, box.Max + margin);
+        m_Nodes[proxyID].UserData = userData;
+
+        InsertLeaf(proxyID);
+        m_ProxyCount++;
+        return proxyID;
+    }
+
+    void DynamicAABBTree::DestroyProxy(int32_t proxyID) {
+        CE_CORE_ASSERT(m_Nodes[proxyID].IsLeaf(), "Proxy must be a leaf");
+
+        RemoveLeaf(proxyID);
+        FreeNode(proxyID);
+        m_ProxyCount--;
+    }
+
+    bool DynamicAABBTree::MoveProxy(int32_t proxyID, const AABB& box, const glm::vec3& displacement) {
+        CE_CORE_ASSERT(m_Nodes[proxyID].IsLeaf(), "Proxy must be a leaf");
+
+        // Still enclosed by the fat box: nothing to do
+        if (m_Nodes[proxyID].Box.Contains(box))
+            return false;
+
+        RemoveLeaf(proxyID);
+
+        glm::vec3 margin(m_Margin);
+        AABB fat(box.Min - margin, box.Max + margin);
+
+        // Predict motion so steadily moving objects are not reinserted every frame
+        glm::vec3 predicted = displacement * 2.0f;
+        fat.Min = glm::min(fat.Min, fat.Min + predicted);
+        fat.Max = glm::max(fat.Max, fat.Max + predicted);
+
+        m_Nodes[proxyID].Box = fat;
+        InsertLeaf(proxyID);
+        return true;
+    }
+
+    void DynamicAABBTree::Clear() {
+        m_Nodes.clear();
+        m_Root = NullNode;
+        m_FreeList = NullNode;
+        m_ProxyCount = 0;
+    }
+
+    void DynamicAABBTree::InsertLeaf(int32_t leaf) {
+        if (m_Root == NullNode) {
+            m_Root = leaf;
+            m_Nodes[m_Root].Parent = NullNode;
+            return;
+        }
+
+        // Descend towards the sibling with the lowest surface area cost
+        AABB leafBox = m_Nodes[leaf].Box;
+        int32_t index = m_Root;
+        while (!m_Nodes[index].IsLeaf()) {
+            int32_t child1 = m_Nodes[index].Child1;
+            int32_t child2 = m_Nodes[index].Child2;
+
+            float area = m_Nodes[index].Box.GetHalfArea();
+            float combinedArea = Union(m_Nodes[index].Box, leafBox).GetHalfArea();
+
+            // Cost of pairing the leaf with this node, and the cost pushed down to children
+            float cost = 2.0f * combinedArea;
+            float inheritanceCost = 2.0f * (combinedArea - area);
+
+            auto descendCost = [&](int32_t child) {
+                float childCost = Union(leafBox, m_Nodes[child].Box).GetHalfArea();
+                if (!m_Nodes[child].IsLeaf())
+                    childCost -= m_Nodes[child].Box.GetHalfArea();
+                return childCost + inheritanceCost;
+            };
+
+            float cost1 = descendCost(child1);
+            float cost2 = descendCost(child2);
+            if (cost < cost1 && cost < cost2)
+                break;
+
+            index = cost1 < cost2 ? child1 : child2;
+        }
+
+        int32_t sibling = index;
+
+        // Replace the sibling with a new parent holding both
+        int32_t oldParent = m_Nodes[sibling].Parent;
+        int32_t newParent = AllocateNode();
+        m_Nodes[newParent].Parent = oldParent;
+        m_Nodes[newParent].Box = Union(leafBox, m_Nodes[sibling].Box);
+        m_Nodes[newParent].Height = m_Nodes[sibling].Height + 1;
+        m_Nodes[newParent].Child1 = sibling;
+        m_Nodes[newParent].Child2 = leaf;
+        m_Nodes[sibling].Parent = newParent;
+        m_Nodes[leaf].Parent = newParent;
+
+        if (oldParent != NullNode) {
+            if (m_Nodes[oldParent].Child1 == sibling)
+                m_Nodes[oldParent].Child1 = newParent;
+            else
+                m_Nodes[oldParent].Child2 = newParent;
+        } else {
+            m_Root = newParent;
+        }
+
+        // Refit and rebalance up to the root
+        index = m_Nodes[leaf].Parent;
+        while (index != NullNode) {
+            index = Balance(index);
+
+            int32_t child1 = m_Nodes[index].Child1;
+            int32_t child2 = m_Nodes[index].Child2;
+            m_Nodes[index].Height = 1 + std::max(m_Nodes[child1].Height, m_Nodes[child2].Height);
+            m_Nodes[index].Box = Union(m_Nodes[child1].Box, m_Nodes[child2].Box);
+
+            index = m_Nodes[index].Parent;
+        }
+    }
+
+    void DynamicAABBTree::RemoveLeaf(int32_t leaf) {
+        if (leaf == m_Root) {
+            m_Root = NullNode;
+            return;
+        }
+
+        int32_t parent = m_Nodes[leaf].Parent;
+        int32_t grandParent = m_Nodes[parent].Parent;
+        int32_t sibling = m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+        if (grandParent == NullNode) {
+            m_Root = sibling;
+            m_Nodes[sibling].Parent = NullNode;
+            FreeNode(parent);
+            return;
+        }
+
+        // Splice the sibling into the grandparent and drop the parent
+        if (m_Nodes[grandParent].Child1 == parent)
+            m_Nodes[grandParent].Child1 = sibling;
+        else
+            m_Nodes[grandParent].Child2 = sibling;
+        m_Nodes[sibling].Parent = grandParent;
+        FreeNode(parent);
+
+        int32_t index = grandParent;
+        while (index != NullNode) {
+            index = Balance(index);
+
+            int32_t child1 = m_Nodes[index].Child1;
+            int32_t child2 = m_Nodes[index].Child2;
+            m_Nodes[index].Box = Union(m_Nodes[child1].Box, m_Nodes[child2].Box);
+            m_Nodes[index].Height = 1 + std::max(m_Nodes[child1].Height, m_Nodes[child2].Height);
+
+            index = m_Nodes[index].Parent;
+        }
+    }
+
+    // Performs a left or right rotation if node A is imbalanced; returns the new subtree root
+    int32_t DynamicAABBTree::Balance(int32_t iA) {
+        Node* A = &m_Nodes[iA];
+        if (A->IsLeaf() || A->Height < 2)
+            return iA;
+
+        int32_t iB = A->Child1;
+        int32_t iC = A->Child2;
+        Node* B = &m_Nodes[iB];
+        Node* C = &m_Nodes[iC];
+
+        int32_t balance = C->Height - B->Height;
+
+        // Rotate C up
+        if (balance > 1) {
+            int32_t iF = C->Child1;
+            int32_t iG = C->Child2;
+            Node* F = &m_Nodes[iF];
+            Node* G = &m_Nodes[iG];
+
+            C->Child1 = iA;
+            C->Parent = A->Parent;
+            A->Parent = iC;
+
+            if (C->Parent != NullNode) {
+                if (m_Nodes[C->Parent].Child1 == iA)
+                    m_Nodes[C->Parent].Child1 = iC;
+                else
+                    m_Nodes[C->Parent].Child2 = iC;
+            } else {
+                m_Root = iC;
+            }
+
+            if (F->Height > G->Height) {
+                C->Child2 = iF;
+                A->Child2 = iG;
+                G->Parent = iA;
+                A->Box = Union(B->Box, G->Box);
+                C->Box = Union(A->Box, F->Box);
+                A->Height = 1 + std::max(B->Height, G->Height);
+                C->Height = 1 + std::max(A->Height, F->Height);
+            } else {
+                C->Child2 = iG;
+                A->Child2 = iF;
+                F->Parent = iA;
+                A->Box = Union(B->Box, F->Box);
+                C->Box = Union(A->Box, G->Box);
+                A->Height = 1 + std::max(B->Height, F->Height);
+                C->Height = 1 + std::max(A->Height, G->Height);
+            }
+            return iC;
+        }
+
+        // Rotate B up
+        if (balance < -1) {
+            int32_t iD = B->Child1;
+            int32_t iE = B->Child2;
+            Node* D = &m_Nodes[iD];
+            Node* E = &m_Nodes[iE];
+
+            B->Child1 = iA;
+            B->Parent = A->Parent;
+            A->Parent = iB;
+
+            if (B->Parent != NullNode) {
+                if (m_Nodes[B->Parent].Child1 == iA)
+                    m_Nodes[B->Parent].Child1 = iB;
+                else
+                    m_Nodes[B->Parent].Child2 = iB;
+            } else {
+                m_Root = iB;
+            }
+
+            if (D->Height > E->Height) {
+                B->Child2 = iD;
+                A->Child1 = iE;
+                E->Parent = iA;
+                A->Box = Union(C->Box, E->Box);
+                B->Box = Union(A->Box, D->Box);
+                A->Height = 1 + std::max(C->Height, E->Height);
+                B->Height = 1 + std::max(A->Height, D->Height);
+            } else {
+                B->Child2 = iE;
+                A->Child1 = iD;
+                D->Parent = iA;
+                A->Box = Union(C->Box, D->Box);
+                B->Box = Union(A->Box, E->Box);
+                A->Height = 1 + std::max(C->Height, D->Height);
+                B->Height = 1 + std::max(A->Height, E->Height);
+            }
+            return iB;
+        }
+
+        return iA;
+    }
+
+}
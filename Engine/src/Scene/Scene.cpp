@@ -1,6 +1,8 @@
 #include "ClaudeEngine/Scene/Scene.h"
 #include "ClaudeEngine/Scene/Entity.h"
 #include "ClaudeEngine/Scene/Components.h"
+#include "ClaudeEngine/Renderer/Model.h"
+#include "ClaudeEngine/Renderer/FrustumCuller.h"
 #include "ClaudeEngine/Core/Log.h"
 #include <random>
 
@@ -10,12 +12,19 @@ namespace ClaudeEngine {
     static std::mt19937_64 s_Engine(s_RandomDevice());
     static std::uniform_int_distribution<uint64_t> s_UniformDistribution;
 
+    SceneBoundsCache::SceneBoundsCache()
+        : Bounds(CreateScope<BoundsSoA>()) {}
+
+    SceneBoundsCache::~SceneBoundsCache() = default;
+
     Scene::Scene(const std::string& name)
         : m_Name(name) {
         CE_CORE_INFO("Creating scene: ", name);
+        m_Registry.on_destroy<TransformComponent>().connect<&Scene::OnTransformDestroyed>(*this);
     }
 
     Scene::~Scene() {
+        m_Registry.on_destroy<TransformComponent>().disconnect<&Scene::OnTransformDestroyed>(*this);
     }
 
     Entity Scene::CreateEntity(const std::string& name) {
@@ -84,4 +93,127 @@ namespace ClaudeEngine {
         return result;
     }
 
+    void Scene::UpdateBoundsCache() {
+        auto view = m_Registry.view<TransformComponent>();
+
+        m_BoundsCache.Entities.clear();
+        m_BoundsCache.Cullable.clear();
+        m_BoundsCache.Bounds->Clear(); // Keeps capacity from the previous frame
+
+        const AABB unitCube(glm::vec3(-0.5f), glm::vec3(0.5f));
+        for (auto entity : view) {
+            const TransformComponent& transform = view.get<TransformComponent>(entity);
+
+            AABB localBounds = unitCube;
+            bool cullable = true;
+            if (const MeshRendererComponent* mr = m_Registry.try_get<MeshRendererComponent>(entity)) {
+                localBounds = AABB(mr->BoundingBoxMin, mr->BoundingBoxMax);
+                cullable = mr->FrustumCulling;
+            }
+
+            AABB worldBounds = localBounds.Transform(transform.GetTransform());
+            m_BoundsCache.Entities.push_back(entity);
+            m_BoundsCache.Cullable.push_back(cullable ? 1 : 0);
+            m_BoundsCache.Bounds->Push(worldBounds);
+
+            SyncSpatialProxy(entity, worldBounds);
+        }
+    }
+
+    void Scene::SyncSpatialProxy(entt::entity entity, const AABB& worldBounds) {
+        glm::vec3 center = worldBounds.GetCenter();
+
+        auto it = m_SpatialProxies.find((uint32_t)entity);
+        if (it == m_SpatialProxies.end()) {
+            int32_t proxyID = m_SpatialIndex.CreateProxy(worldBounds, (uint32_t)entity);
+            m_SpatialProxies.emplace((uint32_t)entity, SpatialProxy{ proxyID, center });
+            if ((size_t)proxyID >= m_ProxyBounds.size())
+                m_ProxyBounds.resize(proxyID + 1);
+            m_ProxyBounds[proxyID] = worldBounds;
+            return;
+        }
+
+        // Only reinserts once the entity leaves its fat box
+        SpatialProxy& proxy = it->second;
+        m_SpatialIndex.MoveProxy(proxy.ProxyID, worldBounds, center - proxy.LastCenter);
+        proxy.LastCenter = center;
+        m_ProxyBounds[proxy.ProxyID] = worldBounds;
+    }
+
+    void Scene::OnTransformDestroyed(entt::registry& registry, entt::entity entity) {
+        auto it = m_SpatialProxies.find((uint32_t)entity);
+        if (it == m_SpatialProxies.end())
+            return;
+
+        m_SpatialIndex.DestroyProxy(it->second.ProxyID);
+        m_SpatialProxies.erase(it);
+    }
+
+    void Scene::QueryFrustum(const Frustum& frustum, std::vector<entt::entity>& result) const {
+        m_SpatialIndex.Query(frustum, [&](int32_t proxyID) {
+            if (frustum.Intersects(m_ProxyBounds[proxyID]))
+                result.push_back((entt::entity)m_SpatialIndex.GetUserData(proxyID));
+            return true;
+        });
+    }
+
+    void Scene::QueryBox(const AABB& box, std::vector<entt::entity>& result) const {
+        m_SpatialIndex.Query(box, [&](int32_t proxyID) {
+            if (box.Overlaps(m_ProxyBounds[proxyID]))
+                result.push_back((entt::entity)m_SpatialIndex.GetUserData(proxyID));
+            return true;
+        });
+    }
+
+    entt::entity Scene::Raycast(const Ray& ray, float maxDistance, float* hitDistance) const {
+        entt::entity closest = entt::null;
+        float closestDistance = maxDistance;
+
+        m_SpatialIndex.RayCast(ray, maxDistance, [&](int32_t proxyID, float) {
+            float distance;
+            if (m_ProxyBounds[proxyID].Intersects(ray, closestDistance, distance) && distance < closestDistance) {
+                closestDistance = distance;
+                closest = (entt::entity)m_SpatialIndex.GetUserData(proxyID);
+            }
+            return closestDistance;
+        });
+
+        if (hitDistance && closest != entt::null)
+            *hitDistance = closestDistance;
+        return closest;
+    }
+
+    entt::entity Scene::Pick(const Ray& ray, float maxDistance, float* hitDistance) const {
+        entt::entity closest = entt::null;
+        float closestDistance = maxDistance;
+
+        m_SpatialIndex.RayCast(ray, maxDistance, [&](int32_t proxyID, float) {
+            float distance;
+            if (!m_ProxyBounds[proxyID].Intersects(ray, closestDistance, distance))
+                return closestDistance;
+
+            entt::entity entity = (entt::entity)m_SpatialIndex.GetUserData(proxyID);
+            const MeshRendererComponent* mr = m_Registry.try_get<MeshRendererComponent>(entity);
+            if (mr && !mr->Visible)
+                return closestDistance;
+            if (mr && mr->ModelAsset) {
+                // An unnormalized model-space direction keeps distances in world units
+                glm::mat4 inverse = glm::inverse(m_Registry.get<TransformComponent>(entity).GetTransform());
+                Ray localRay(glm::vec3(inverse * glm::vec4(ray.Origin, 1.0f)), glm::vec3(inverse * glm::vec4(ray.Direction, 0.0f)));
+                if (!mr->ModelAsset->Raycast(localRay, closestDistance, distance))
+                    return closestDistance;
+            }
+
+            if (distance < closestDistance) {
+                closestDistance = distance;
+                closest = entity;
+            }
+            return closestDistance;
+        });
+
+        if (hitDistance && closest != entt::null)
+            *hitDistance = closestDistance;
+        return closest;
+    }
+
 }
@@ -1,22 +1,42 @@
 #type vertex
-#version 330 core
+#version 460 core
 
 layout(location = 0) in vec3 a_Position;
 
-uniform mat4 u_ViewProjection;
-uniform mat4 u_Transform;
+layout(std140, binding = 0) uniform Camera {
+    mat4 u_ViewProjection;
+    mat4 u_View;
+    mat4 u_Projection;
+    vec4 u_CameraPosition;
+    float u_Near;
+    float u_Far;
+};
+
+// Per-instance data written by Renderer3D, see InstanceData
+struct InstanceData {
+    mat4 Transform;
+    vec4 Color;
+};
+
+layout(std430, binding = 1) readonly buffer Instances {
+    InstanceData u_Instances[];
+};
+
+out vec4 v_Color;
 
 void main() {
-    gl_Position = u_ViewProjection * u_Transform * vec4(a_Position, 1.0);
+    InstanceData instance = u_Instances[gl_BaseInstance + gl_InstanceID];
+    v_Color = instance.Color;
+    gl_Position = u_ViewProjection * instance.Transform * vec4(a_Position, 1.0);
 }
 
 #type fragment
-#version 330 core
+#version 460 core
 
 layout(location = 0) out vec4 FragColor;
 
-uniform vec4 u_Color;
+in vec4 v_Color;
 
 void main() {
-    FragColor = u_Color;
+    FragColor = v_Color;
 }
@@ -0,0 +1,38 @@
+#type vertex
+#version 460 core
+
+// Entity ID pass for framebuffer picking, see Renderer3D::DrawEntityID
+layout(location = 0) in vec3 a_Position;
+
+layout(std140, binding = 0) uniform Camera {
+    mat4 u_ViewProjection;
+};
+
+// Per-instance data written by Renderer3D, see InstanceData; Color.r carries the ID's bits
+struct InstanceData {
+    mat4 Transform;
+    vec4 Color;
+};
+
+layout(std430, binding = 1) readonly buffer Instances {
+    InstanceData u_Instances[];
+};
+
+flat out int v_EntityID;
+
+void main() {
+    InstanceData instance = u_Instances[gl_BaseInstance + gl_InstanceID];
+    v_EntityID = floatBitsToInt(instance.Color.r);
+    gl_Position = u_ViewProjection * instance.Transform * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 460 core
+
+layout(location = 0) out int o_EntityID;
+
+flat in int v_EntityID;
+
+void main() {
+    o_EntityID = v_EntityID;
+}
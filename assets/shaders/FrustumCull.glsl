@@ -0,0 +1,134 @@
+#type compute
+#version 460 core
+
+// One invocation per instance. Survivors append a single-instance draw command to
+// their draw group; the group's count feeds glMultiDrawElementsIndirectCount.
+layout(local_size_x = 64) in;
+
+layout(std140, binding = 0) uniform Camera {
+    mat4 u_ViewProjection;
+    mat4 u_View;
+    mat4 u_Projection;
+    vec4 u_CameraPosition;
+    float u_Near;
+    float u_Far;
+};
+
+// See CullRecord in Renderer3D.cpp. Negative extents mean "always visible".
+struct CullRecord {
+    vec3 Center;
+    uint Batch;
+    vec3 Extents;
+    uint Group;
+};
+
+struct DrawCommand {
+    uint IndexCount;
+    uint InstanceCount;
+    uint FirstIndex;
+    int BaseVertex;
+    uint BaseInstance;
+};
+
+struct DrawGroup {
+    uint DrawCount;
+    uint FirstCommand;
+};
+
+layout(std430, binding = 3) readonly buffer BatchCommands {
+    DrawCommand u_BatchCommands[];
+};
+
+layout(std430, binding = 4) readonly buffer CullRecords {
+    CullRecord u_Records[];
+};
+
+layout(std430, binding = 5) writeonly buffer VisibleCommands {
+    DrawCommand u_VisibleCommands[];
+};
+
+layout(std430, binding = 6) buffer DrawGroups {
+    DrawGroup u_Groups[];
+};
+
+layout(std430, binding = 7) buffer CullStatistics {
+    uint u_OccludedCount;
+};
+
+// Hi-Z pyramid of this frame's occluders, see HiZBuild.glsl
+layout(binding = 0) uniform sampler2D u_DepthPyramid;
+
+uniform vec4 u_FrustumPlanes[6];
+uniform int u_RecordCount;
+uniform int u_OcclusionCulling;
+
+const uint c_NoGroup = 0xFFFFFFFFu;
+
+// Same test as OcclusionBuffer::IsOccluded
+bool IsOccluded(vec3 center, vec3 extents) {
+    vec2 uvMin = vec2(1.0);
+    vec2 uvMax = vec2(0.0);
+    float nearest = 1.0;
+    for (int i = 0; i < 8; i++) {
+        vec3 corner = center + extents * vec3((i & 1) != 0 ? 1.0 : -1.0,
+                                              (i & 2) != 0 ? 1.0 : -1.0,
+                                              (i & 4) != 0 ? 1.0 : -1.0);
+        vec4 clip = u_ViewProjection * vec4(corner, 1.0);
+        // Boxes crossing the near plane have no finite screen rect
+        if (clip.w <= 0.0)
+            return false;
+
+        vec3 ndc = clip.xyz / clip.w;
+        vec2 uv = ndc.xy * 0.5 + 0.5;
+        uvMin = min(uvMin, uv);
+        uvMax = max(uvMax, uv);
+        nearest = min(nearest, ndc.z * 0.5 + 0.5);
+    }
+    uvMin = clamp(uvMin, 0.0, 1.0);
+    uvMax = clamp(uvMax, 0.0, 1.0);
+
+    // First level where the rect spans at most two texels per axis, so four fetches cover it
+    vec2 extent = (uvMax - uvMin) * vec2(textureSize(u_DepthPyramid, 0));
+    int level = int(ceil(log2(max(max(extent.x, extent.y), 1.0))));
+    level = min(level, textureQueryLevels(u_DepthPyramid) - 1);
+
+    ivec2 size = textureSize(u_DepthPyramid, level);
+    ivec2 first = min(ivec2(uvMin * vec2(size)), size - 1);
+    ivec2 last = min(ivec2(uvMax * vec2(size)), size - 1);
+    float farthest = max(max(texelFetch(u_DepthPyramid, first, level).r,
+                             texelFetch(u_DepthPyramid, ivec2(last.x, first.y), level).r),
+                         max(texelFetch(u_DepthPyramid, ivec2(first.x, last.y), level).r,
+                             texelFetch(u_DepthPyramid, last, level).r));
+    return nearest > farthest;
+}
+
+void main() {
+    uint index = gl_GlobalInvocationID.x;
+    if (index >= uint(u_RecordCount))
+        return;
+
+    CullRecord record = u_Records[index];
+    if (record.Group == c_NoGroup)
+        return;
+
+    if (record.Extents.x >= 0.0) {
+        for (int i = 0; i < 6; i++) {
+            vec4 plane = u_FrustumPlanes[i];
+            float radius = dot(record.Extents, abs(plane.xyz));
+            if (dot(plane.xyz, record.Center) + plane.w < -radius)
+                return;
+        }
+
+        if (u_OcclusionCulling != 0 && IsOccluded(record.Center, record.Extents)) {
+            atomicAdd(u_OccludedCount, 1u);
+            return;
+        }
+    }
+
+    DrawCommand command = u_BatchCommands[record.Batch];
+    command.InstanceCount = 1u;
+    command.BaseInstance = index;
+
+    uint slot = atomicAdd(u_Groups[record.Group].DrawCount, 1u);
+    u_VisibleCommands[u_Groups[record.Group].FirstCommand + slot] = command;
+}
@@ -1,9 +1,16 @@
 #type vertex
-#version 330 core
+#version 460 core
 
 layout(location = 0) in vec3 a_Position;
 
-uniform mat4 u_ViewProjection;
+layout(std140, binding = 0) uniform Camera {
+    mat4 u_ViewProjection;
+    mat4 u_View;
+    mat4 u_Projection;
+    vec4 u_CameraPosition;
+    float u_Near;
+    float u_Far;
+};
 
 out vec3 v_NearPoint;
 out vec3 v_FarPoint;
@@ -22,16 +29,21 @@ void main() {
 }
 
 #type fragment
-#version 330 core
+#version 460 core
 
 layout(location = 0) out vec4 FragColor;
 
 in vec3 v_NearPoint;
 in vec3 v_FarPoint;
 
-uniform mat4 u_ViewProjection;
-uniform float u_Near;
-uniform float u_Far;
+layout(std140, binding = 0) uniform Camera {
+    mat4 u_ViewProjection;
+    mat4 u_View;
+    mat4 u_Projection;
+    vec4 u_CameraPosition;
+    float u_Near;
+    float u_Far;
+};
 
 vec4 grid(vec3 fragPos3D, float scale) {
     vec2 coord = fragPos3D.xz * scale;
@@ -0,0 +1,31 @@
+#type compute
+#version 460 core
+
+// Writes one level of the Hi-Z pyramid. Every texel keeps the farthest depth of all source
+// texels it overlaps, which stays conservative when the source is not a power of two.
+layout(local_size_x = 8, local_size_y = 8) in;
+
+// The depth attachment for level 0, the pyramid itself afterwards
+layout(binding = 0) uniform sampler2D u_Source;
+layout(r32f, binding = 0) uniform writeonly image2D u_Destination;
+
+uniform int u_SourceLevel;
+
+void main() {
+    ivec2 texel = ivec2(gl_GlobalInvocationID.xy);
+    ivec2 size = imageSize(u_Destination);
+    if (any(greaterThanEqual(texel, size)))
+        return;
+
+    ivec2 sourceSize = textureSize(u_Source, u_SourceLevel);
+    ivec2 first = texel * sourceSize / size;
+    ivec2 last = ((texel + 1) * sourceSize + size - 1) / size - 1;
+
+    float depth = 0.0;
+    for (int y = first.y; y <= last.y; y++) {
+        for (int x = first.x; x <= last.x; x++)
+            depth = max(depth, texelFetch(u_Source, ivec2(x, y), u_SourceLevel).r);
+    }
+
+    imageStore(u_Destination, texel, vec4(depth));
+}
@@ -1,14 +1,38 @@
+// Feature keywords; each enabled one is #defined in the variant compiled for it (see Material)
+#pragma features ALBEDO_MAP NORMAL_MAP METALLIC_ROUGHNESS_MAP AO_MAP EMISSION_MAP
+
 #type vertex
 #version 460 core
 
-layout(location = 0) in vec3 a_Position;
+// Packed vertex formats (see VertexFormat.h) store octahedral normal/tangent in .xy, drop the
+// bitangent and keep its sign in a_Position.w; Standard leaves w at 1
+layout(location = 0) in vec4 a_Position;
 layout(location = 1) in vec3 a_Normal;
 layout(location = 2) in vec2 a_TexCoords;
 layout(location = 3) in vec3 a_Tangent;
 layout(location = 4) in vec3 a_Bitangent;
 
-uniform mat4 u_ViewProjection;
-uniform mat4 u_Transform;
+uniform int u_VertexFormat; // 0 = Standard
+
+layout(std140, binding = 0) uniform Camera {
+    mat4 u_ViewProjection;
+    mat4 u_View;
+    mat4 u_Projection;
+    vec4 u_CameraPosition;
+    float u_Near;
+    float u_Far;
+};
+
+// Per-instance data written by Renderer3D, see InstanceData
+struct InstanceData {
+    mat4 Transform;
+    vec4 Color;
+};
+
+layout(std430, binding = 1) readonly buffer Instances {
+    InstanceData u_Instances[];
+};
+
 uniform mat4 u_NormalMatrix;
 
 out VS_OUT {
@@ -20,15 +44,33 @@ out VS_OUT {
     mat3 TBN;
 } vs_out;
 
+vec3 DecodeOctahedral(vec2 e) {
+    vec3 v = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (v.z < 0.0)
+        v.xy = (1.0 - abs(v.yx)) * vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+    return normalize(v);
+}
+
 void main() {
-    vec4 worldPos = u_Transform * vec4(a_Position, 1.0);
+    // Quantized positions are dequantized by the instance transform
+    mat4 transform = u_Instances[gl_BaseInstance + gl_InstanceID].Transform;
+    vec4 worldPos = transform * vec4(a_Position.xyz, 1.0);
     vs_out.FragPos = worldPos.xyz;
     vs_out.TexCoords = a_TexCoords;
+
+    vec3 normal = a_Normal;
+    vec3 tangent = a_Tangent;
+    vec3 bitangent = a_Bitangent;
+    if (u_VertexFormat != 0) {
+        normal = DecodeOctahedral(a_Normal.xy);
+        tangent = DecodeOctahedral(a_Tangent.xy);
+        bitangent = cross(normal, tangent) * a_Position.w;
+    }
     
     // Calculate TBN matrix for normal mapping
-    vec3 T = normalize(vec3(u_Transform * vec4(a_Tangent, 0.0)));
-    vec3 B = normalize(vec3(u_Transform * vec4(a_Bitangent, 0.0)));
-    vec3 N = normalize(vec3(u_Transform * vec4(a_Normal, 0.0)));
+    vec3 T = normalize(vec3(transform * vec4(tangent, 0.0)));
+    vec3 B = normalize(vec3(transform * vec4(bitangent, 0.0)));
+    vec3 N = normalize(vec3(transform * vec4(normal, 0.0)));
     vs_out.TBN = mat3(T, B, N);
     
     vs_out.Normal = N;
@@ -52,35 +94,52 @@ in VS_OUT {
     mat3 TBN;
 } fs_in;
 
-// Material properties (Ray Tracing focused)
-struct Material {
+// Material properties (Ray Tracing focused), see MaterialParameters
+layout(std140, binding = 2) uniform MaterialParameters {
     vec3 Albedo;
     float Metallic;
-    float Roughness;
-    float AO;
     vec3 Emission;
     float EmissionStrength;
+    float Roughness;
+    float AO;
     float IOR;
     float Transmission;
-};
+    float NormalStrength;
+    int UseAlbedoMap;
+    int UseNormalMap;
+    int UseMetallicRoughnessMap;
+    int UseAOMap;
+    int UseEmissionMap;
+} u_Material;
 
-uniform Material u_Material;
-
-// Texture maps
-uniform sampler2D u_AlbedoMap;
-uniform sampler2D u_NormalMap;
-uniform sampler2D u_MetallicRoughnessMap;
-uniform sampler2D u_AOMap;
-uniform sampler2D u_EmissionMap;
-
-uniform int u_UseAlbedoMap;
-uniform int u_UseNormalMap;
-uniform int u_UseMetallicRoughnessMap;
-uniform int u_UseAOMap;
-uniform int u_UseEmissionMap;
+// Texture maps on fixed units, see MaterialTextureSlot. Only the variant's maps are declared;
+// the Use*Map fields above are left to the layout and no longer read
+#ifdef ALBEDO_MAP
+layout(binding = 0) uniform sampler2D u_AlbedoMap;
+#endif
+#ifdef NORMAL_MAP
+layout(binding = 1) uniform sampler2D u_NormalMap;
+#endif
+#ifdef METALLIC_ROUGHNESS_MAP
+layout(binding = 2) uniform sampler2D u_MetallicRoughnessMap;
+#endif
+#ifdef AO_MAP
+layout(binding = 3) uniform sampler2D u_AOMap;
+#endif
+#ifdef EMISSION_MAP
+layout(binding = 4) uniform sampler2D u_EmissionMap;
+#endif
 
 // Lighting
-uniform vec3 u_CameraPos;
+layout(std140, binding = 0) uniform Camera {
+    mat4 u_ViewProjection;
+    mat4 u_View;
+    mat4 u_Projection;
+    vec4 u_CameraPosition;
+    float u_Near;
+    float u_Far;
+};
+
 uniform vec3 u_LightDirection;
 uniform vec3 u_LightColor;
 uniform float u_LightIntensity;
@@ -128,43 +187,48 @@ float GeometrySmith(vec3 N, vec3 V, vec3 L, float roughness) {
 
 void main() {
     // Sample textures
+#ifdef ALBEDO_MAP
+    vec3 albedo = texture(u_AlbedoMap, fs_in.TexCoords).rgb;
+    albedo = pow(albedo, vec3(2.2)); // Gamma correction
+#else
     vec3 albedo = u_Material.Albedo;
-    if (u_UseAlbedoMap == 1) {
-        albedo = texture(u_AlbedoMap, fs_in.TexCoords).rgb;
-        albedo = pow(albedo, vec3(2.2)); // Gamma correction
-    }
+#endif
     
+#ifdef NORMAL_MAP
+    vec3 normal = texture(u_NormalMap, fs_in.TexCoords).rgb;
+    normal = normal * 2.0 - 1.0;
+    normal = normalize(fs_in.TBN * normal);
+#else
     vec3 normal = normalize(fs_in.Normal);
-    if (u_UseNormalMap == 1) {
-        normal = texture(u_NormalMap, fs_in.TexCoords).rgb;
-        normal = normal * 2.0 - 1.0;
-        normal = normalize(fs_in.TBN * normal);
-    }
+#endif
     
+#ifdef METALLIC_ROUGHNESS_MAP
+    vec3 mr = texture(u_MetallicRoughnessMap, fs_in.TexCoords).rgb;
+    float metallic = mr.b;
+    float roughness = mr.g;
+#else
     float metallic = u_Material.Metallic;
     float roughness = u_Material.Roughness;
-    if (u_UseMetallicRoughnessMap == 1) {
-        vec3 mr = texture(u_MetallicRoughnessMap, fs_in.TexCoords).rgb;
-        metallic = mr.b;
-        roughness = mr.g;
-    }
+#endif
     
+#ifdef AO_MAP
+    float ao = texture(u_AOMap, fs_in.TexCoords).r;
+#else
     float ao = u_Material.AO;
-    if (u_UseAOMap == 1) {
-        ao = texture(u_AOMap, fs_in.TexCoords).r;
-    }
+#endif
     
+#ifdef EMISSION_MAP
+    vec3 emission = texture(u_EmissionMap, fs_in.TexCoords).rgb * u_Material.EmissionStrength;
+#else
     vec3 emission = u_Material.Emission * u_Material.EmissionStrength;
-    if (u_UseEmissionMap == 1) {
-        emission = texture(u_EmissionMap, fs_in.TexCoords).rgb * u_Material.EmissionStrength;
-    }
+#endif
     
     // Calculate reflectance at normal incidence
     vec3 F0 = vec3(0.04);
     F0 = mix(F0, albedo, metallic);
     
     // View direction
-    vec3 V = normalize(u_CameraPos - fs_in.FragPos);
+    vec3 V = normalize(u_CameraPosition.xyz - fs_in.FragPos);
     vec3 L = normalize(-u_LightDirection);
     vec3 H = normalize(V + L);
     
@@ -0,0 +1,47 @@
+#type vertex
+#version 460 core
+
+// Vertex format benchmark: reads and decodes every attribute the way PBR_RayTracing does
+layout(location = 0) in vec4 a_Position;
+layout(location = 1) in vec3 a_Normal;
+layout(location = 2) in vec2 a_TexCoords;
+layout(location = 3) in vec3 a_Tangent;
+layout(location = 4) in vec3 a_Bitangent;
+
+uniform int u_VertexFormat; // 0 = Standard
+uniform mat4 u_Transform;
+
+out vec4 v_Attributes;
+
+vec3 DecodeOctahedral(vec2 e) {
+    vec3 v = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (v.z < 0.0)
+        v.xy = (1.0 - abs(v.yx)) * vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+    return normalize(v);
+}
+
+void main() {
+    vec3 normal = a_Normal;
+    vec3 tangent = a_Tangent;
+    vec3 bitangent = a_Bitangent;
+    if (u_VertexFormat != 0) {
+        normal = DecodeOctahedral(a_Normal.xy);
+        tangent = DecodeOctahedral(a_Tangent.xy);
+        bitangent = cross(normal, tangent) * a_Position.w;
+    }
+
+    // Everything feeds the outputs so no attribute fetch is compiled away
+    v_Attributes = vec4(normal + tangent + bitangent, a_TexCoords.x + a_TexCoords.y);
+    gl_Position = u_Transform * vec4(a_Position.xyz + v_Attributes.xyz * 0.001, 1.0);
+}
+
+#type fragment
+#version 460 core
+
+layout(location = 0) out vec4 FragColor;
+
+in vec4 v_Attributes;
+
+void main() {
+    FragColor = v_Attributes;
+}